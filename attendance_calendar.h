@@ -0,0 +1,190 @@
+#ifndef ATTENDANCE_CALENDAR_H
+#define ATTENDANCE_CALENDAR_H
+
+#include "attendance_store.h"
+#include "date_utils.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <algorithm>
+using namespace std;
+
+// Per-employee, per-year attendance bitmaps. Each year page holds, for every
+// employee slot, a 366-bit "marked" bitmap (days with any record), a 366-bit
+// "present" bitmap and the year's overtime total, laid out as flat columns
+// (100 bytes per employee-year, no per-employee allocations). Attendance over
+// any date window is then a masked popcount over at most six words per year.
+//
+// A day is either present or absent: marking the same day twice keeps the
+// latest answer, while overtime from every record is added to the total.
+class AttendanceCalendar {
+public:
+    static const int WORDS_PER_YEAR = 6; // 366 bits rounded up to 64-bit words
+
+private:
+    struct YearPage {
+        int year;
+        vector<uint64_t> marked;  // WORDS_PER_YEAR words per slot
+        vector<uint64_t> present;
+        vector<int32_t> overtime; // one total per slot
+    };
+
+    vector<YearPage> pages;              // sorted by year
+    unordered_map<int, uint32_t> slotById; // employee ID -> dense slot
+    size_t slotCount;
+
+    YearPage& pageFor(int year) {
+        auto it = lower_bound(pages.begin(), pages.end(), year,
+                              [](const YearPage& p, int y) { return p.year < y; });
+        if (it == pages.end() || it->year != year) {
+            YearPage page;
+            page.year = year;
+            page.marked.assign(slotCount * WORDS_PER_YEAR, 0);
+            page.present.assign(slotCount * WORDS_PER_YEAR, 0);
+            page.overtime.assign(slotCount, 0);
+            it = pages.insert(it, page);
+        }
+        return *it;
+    }
+
+    const YearPage* findPage(int year) const {
+        auto it = lower_bound(pages.begin(), pages.end(), year,
+                              [](const YearPage& p, int y) { return p.year < y; });
+        return (it == pages.end() || it->year != year) ? nullptr : &*it;
+    }
+
+    // Slots are handed out in first-seen order, so pages hold one entry per
+    // employee with attendance whatever the spread of their IDs.
+    bool assignSlot(int empId, size_t& slot) {
+        auto it = slotById.find(empId);
+        if (it != slotById.end()) {
+            slot = it->second;
+            return false;
+        }
+        slot = slotCount++;
+        slotById.emplace(empId, (uint32_t)slot);
+        return true;
+    }
+
+    void growPages() {
+        for (auto& page : pages) {
+            page.marked.resize(slotCount * WORDS_PER_YEAR, 0);
+            page.present.resize(slotCount * WORDS_PER_YEAR, 0);
+            page.overtime.resize(slotCount, 0);
+        }
+    }
+
+    size_t slotFor(int empId) {
+        size_t slot;
+        if (assignSlot(empId, slot)) growPages();
+        return slot;
+    }
+
+    bool findSlot(int empId, size_t& slot) const {
+        auto it = slotById.find(empId);
+        if (it == slotById.end()) return false;
+        slot = it->second;
+        return true;
+    }
+
+    // Bits [fromDoy, toDoy] (inclusive) of a year, as six words
+    static void windowMask(int fromDoy, int toDoy, uint64_t mask[WORDS_PER_YEAR]) {
+        for (int w = 0; w < WORDS_PER_YEAR; w++) {
+            int lo = max(fromDoy - w * 64, 0);
+            int hi = min(toDoy - w * 64, 63);
+            if (lo > hi) {
+                mask[w] = 0;
+            } else {
+                uint64_t upper = (hi == 63) ? ~(uint64_t)0 : (((uint64_t)1 << (hi + 1)) - 1);
+                mask[w] = upper & ~(((uint64_t)1 << lo) - 1);
+            }
+        }
+    }
+
+public:
+    AttendanceCalendar() : slotCount(0) {}
+
+    // Gives every listed employee a slot and sizes the pages once, so a batch
+    // of marks does not grow them one new ID at a time.
+    void reserveIds(const vector<int>& empIds) {
+        slotById.reserve(slotById.size() + empIds.size());
+        bool added = false;
+        size_t slot;
+        for (int id : empIds) added |= assignSlot(id, slot);
+        if (added) growPages();
+    }
+
+    void mark(int empId, int dayNumber, bool present, int overtimeHours) {
+        size_t slot = slotFor(empId);
+        YearPage& page = pageFor(DateUtils::yearOf(dayNumber));
+        int doy = DateUtils::dayOfYear(dayNumber);
+        size_t word = slot * WORDS_PER_YEAR + doy / 64;
+        uint64_t bit = (uint64_t)1 << (doy % 64);
+        page.marked[word] |= bit;
+        if (present) page.present[word] |= bit;
+        else page.present[word] &= ~bit;
+        page.overtime[slot] += overtimeHours;
+    }
+
+    void rebuild(const AttendanceStore& store) {
+        clear();
+        if (store.size() == 0) return;
+        // Assign every slot up front so each page is allocated exactly once
+        size_t slot;
+        for (size_t i = 0; i < store.size(); i++) assignSlot(store.getEmployeeId(i), slot);
+        growPages();
+        for (size_t i = 0; i < store.size(); i++) {
+            mark(store.getEmployeeId(i), store.getDay(i), store.isPresent(i), store.getOvertimeHours(i));
+        }
+    }
+
+    void clear() {
+        pages.clear();
+        slotById.clear();
+        slotCount = 0;
+    }
+
+    // All-time totals: one popcount pass over six words per year page.
+    AttendanceTally tally(int empId) const {
+        AttendanceTally t;
+        size_t slot;
+        if (!findSlot(empId, slot)) return t;
+        for (const auto& page : pages) {
+            const uint64_t* m = &page.marked[slot * WORDS_PER_YEAR];
+            const uint64_t* p = &page.present[slot * WORDS_PER_YEAR];
+            for (int w = 0; w < WORDS_PER_YEAR; w++) {
+                t.totalDays += __builtin_popcountll(m[w]);
+                t.presentDays += __builtin_popcountll(p[w]);
+            }
+            t.overtimeHours += page.overtime[slot];
+        }
+        return t;
+    }
+
+    // Marked/present days within [fromDay, toDay] (day numbers, inclusive).
+    AttendanceTally tallyWindow(int empId, int fromDay, int toDay) const {
+        AttendanceTally t;
+        size_t slot;
+        if (!findSlot(empId, slot) || fromDay > toDay) return t;
+        int firstYear = DateUtils::yearOf(fromDay);
+        int lastYear = DateUtils::yearOf(toDay);
+        for (int year = firstYear; year <= lastYear; year++) {
+            const YearPage* page = findPage(year);
+            if (!page) continue;
+            int yearStart = DateUtils::daysFromCivil(year, 1, 1);
+            int fromDoy = (year == firstYear) ? fromDay - yearStart : 0;
+            int toDoy = (year == lastYear) ? toDay - yearStart : 365;
+            uint64_t mask[WORDS_PER_YEAR];
+            windowMask(fromDoy, toDoy, mask);
+            const uint64_t* m = &page->marked[slot * WORDS_PER_YEAR];
+            const uint64_t* p = &page->present[slot * WORDS_PER_YEAR];
+            for (int w = 0; w < WORDS_PER_YEAR; w++) {
+                t.totalDays += __builtin_popcountll(m[w] & mask[w]);
+                t.presentDays += __builtin_popcountll(p[w] & mask[w]);
+            }
+        }
+        return t;
+    }
+};
+
+#endif
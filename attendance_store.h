@@ -0,0 +1,136 @@
+#ifndef ATTENDANCE_STORE_H
+#define ATTENDANCE_STORE_H
+
+#include "employee.h"
+#include "date_utils.h"
+#include "record_parser.h"
+#include <vector>
+#include <memory_resource>
+#include <cstdint>
+#include <algorithm>
+using namespace std;
+
+// Per-employee attendance totals, as counted by AttendanceCalendar.
+struct AttendanceTally {
+    int totalDays;
+    int presentDays;
+    int overtimeHours;
+    AttendanceTally() : totalDays(0), presentDays(0), overtimeHours(0) {}
+};
+
+// One attendance row as held in versioned snapshots
+struct AttendanceSnapshotRow {
+    int32_t employeeId;
+    int32_t day;
+    bool present;
+    uint8_t overtimeHours;
+};
+
+// Packed columnar attendance log: int32 employee ID, int32 day number, one
+// presence bit and one overtime byte per row (~9 bytes instead of the ~48 of
+// an Attendance object with its date string). Rows are append-only, in the
+// same order as attendance.dat. The columns come from a memory resource so a
+// loaded generation can live in (and be freed with) a LoadArena.
+class AttendanceStore {
+private:
+    pmr::vector<int32_t> employeeIds;
+    pmr::vector<int32_t> days;
+    pmr::vector<uint8_t> overtime;
+    pmr::vector<uint64_t> presentBits;
+    size_t rowCount;
+
+public:
+    explicit AttendanceStore(pmr::memory_resource* mem = pmr::get_default_resource())
+        : employeeIds(mem), days(mem), overtime(mem), presentBits(mem), rowCount(0) {}
+
+    // Drops every row and hands the column buffers back to the resource, so
+    // the arena they came from can then be released as a whole.
+    void release() {
+        pmr::vector<int32_t>(employeeIds.get_allocator()).swap(employeeIds);
+        pmr::vector<int32_t>(days.get_allocator()).swap(days);
+        pmr::vector<uint8_t>(overtime.get_allocator()).swap(overtime);
+        pmr::vector<uint64_t>(presentBits.get_allocator()).swap(presentBits);
+        rowCount = 0;
+    }
+
+    static constexpr int MAX_OVERTIME = 255; // stored in one byte
+
+    static bool isValidOvertime(int hours) { return hours >= 0 && hours <= MAX_OVERTIME; }
+
+    // Out-of-range hours are clamped; callers taking user input reject them
+    // first with isValidOvertime()
+
+    void append(int empId, int dayNumber, bool present, int overtimeHours) {
+        if (rowCount % 64 == 0) presentBits.push_back(0);
+        employeeIds.push_back(empId);
+        days.push_back(dayNumber);
+        overtime.push_back((uint8_t)max(0, min(MAX_OVERTIME, overtimeHours)));
+        if (present) presentBits[rowCount >> 6] |= (uint64_t)1 << (rowCount & 63);
+        rowCount++;
+    }
+
+    // Returns false (and stores nothing) if the record's date is not YYYY-MM-DD
+    bool append(const Attendance& att) {
+        int dayNumber;
+        if (!DateUtils::parseDate(att.getDate(), dayNumber)) return false;
+        append(att.getEmployeeId(), dayNumber, att.isPresent(), att.getOvertimeHours());
+        return true;
+    }
+
+    // Parses "id|YYYY-MM-DD|present|overtime" straight into the columns,
+    // without building an Attendance; false (nothing stored) if malformed.
+    bool appendLine(string_view line) {
+        string_view f[4];
+        int empId, dayNumber, overtimeHours;
+        if (RecordParser::splitFields(line, f, 4) < 4 || !RecordParser::parseInt(f[0], empId) ||
+            !DateUtils::parseDate(f[1], dayNumber) || !RecordParser::parseInt(f[3], overtimeHours)) {
+            return false;
+        }
+        append(empId, dayNumber, f[2] == "1", overtimeHours);
+        return true;
+    }
+
+    void appendAll(const AttendanceStore& other) {
+        reserve(rowCount + other.rowCount);
+        for (size_t i = 0; i < other.rowCount; i++) {
+            append(other.employeeIds[i], other.days[i], other.isPresent(i), other.overtime[i]);
+        }
+    }
+
+    void reserve(size_t n) {
+        employeeIds.reserve(n);
+        days.reserve(n);
+        overtime.reserve(n);
+        presentBits.reserve((n + 63) / 64);
+    }
+
+    // Room for extra more rows, growing at least geometrically: the columns
+    // usually live in a monotonic arena that never reuses a dropped buffer,
+    // so an exact-size reserve per batch would strand a full copy each time.
+    void reserveForAppend(size_t extra) {
+        size_t needed = rowCount + extra;
+        if (needed <= employeeIds.capacity()) return;
+        reserve(max(needed, 2 * employeeIds.capacity()));
+    }
+
+    void clear() {
+        employeeIds.clear();
+        days.clear();
+        overtime.clear();
+        presentBits.clear();
+        rowCount = 0;
+    }
+
+    size_t size() const { return rowCount; }
+    int getEmployeeId(size_t row) const { return employeeIds[row]; }
+    int getDay(size_t row) const { return days[row]; }
+    bool isPresent(size_t row) const { return (presentBits[row >> 6] >> (row & 63)) & 1; }
+    int getOvertimeHours(size_t row) const { return overtime[row]; }
+
+    Attendance getRecord(size_t row) const {
+        return Attendance(employeeIds[row], DateUtils::formatDate(days[row]),
+                          isPresent(row), overtime[row]);
+    }
+};
+
+#endif
@@ -0,0 +1,211 @@
+// Standalone benchmarks for the HR system's data structures; kept out of
+// the main program so its batch mode only carries HR commands.
+//
+//   bench payroll [record count]
+//   bench mvcc [rows] [commits]
+#include "payroll_kernels.h"
+#include "mvcc.h"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <atomic>
+using namespace std;
+
+namespace PayrollBench {
+    using namespace PayrollKernels;
+
+    // The branchy per-employee logic yearEndEvaluation used before the
+    // kernels, kept as the reference they are checked against.
+    inline double referenceRaise(double salary, double score) {
+        double salaryIncrease = 0;
+        if (score >= 90) salaryIncrease = salary * 0.20;
+        else if (score >= 85) salaryIncrease = salary * 0.15;
+        else if (score >= 75) salaryIncrease = salary * 0.10;
+        else if (score >= 65) salaryIncrease = salary * 0.05;
+        else if (score >= 50) salaryIncrease = 0;
+        else salaryIncrease = -(salary * 0.10);
+        salary += salaryIncrease; // Employee::operator+=
+        return salary;
+    }
+
+    // Synthetic check + benchmark: every kernel path must agree bit for bit
+    // with referenceRaise, then each is timed over the same data.
+    inline bool run(size_t n) {
+        mt19937_64 rng(42);
+        uniform_real_distribution<double> salaryDist(500.0, 250000.0);
+        uniform_real_distribution<double> scoreDist(0.0, 100.0);
+        vector<double> salaries(n), scores(n), rates(n);
+        for (size_t i = 0; i < n; i++) {
+            salaries[i] = salaryDist(rng);
+            scores[i] = scoreDist(rng);
+        }
+
+        auto elapsedMs = [](chrono::steady_clock::time_point start) {
+            return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        };
+
+        vector<double> expected(salaries);
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) expected[i] = referenceRaise(expected[i], scores[i]);
+        double referenceMs = elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) rates[i] = RaiseBands::rateForBand(RaiseBands::bandForScore(scores[i]));
+        double bandMs = elapsedMs(start);
+
+        vector<double> scalar(salaries);
+        start = chrono::steady_clock::now();
+        applyRaisesScalar(scalar.data(), rates.data(), n);
+        double scalarMs = elapsedMs(start);
+        bool scalarExact = memcmp(scalar.data(), expected.data(), n * sizeof(double)) == 0;
+
+        cout << "\n========================================\n";
+        cout << "      PAYROLL KERNEL BENCHMARK (" << n << ")\n";
+        cout << "========================================\n";
+        cout << fixed << setprecision(3);
+        cout << left << setw(28) << "Reference (operator+=)" << referenceMs << " ms\n";
+        cout << left << setw(28) << "Band lookup" << bandMs << " ms\n";
+        cout << left << setw(28) << "Scalar raise kernel" << scalarMs << " ms"
+             << (scalarExact ? "  [bit-exact]" : "  [MISMATCH]") << "\n";
+        bool allExact = scalarExact;
+
+#ifdef HR_HAVE_AVX2_KERNELS
+        if (hasAvx2()) {
+            vector<double> simd(salaries);
+            start = chrono::steady_clock::now();
+            applyRaisesAvx2(simd.data(), rates.data(), n);
+            double simdMs = elapsedMs(start);
+            bool simdExact = memcmp(simd.data(), expected.data(), n * sizeof(double)) == 0;
+            allExact = allExact && simdExact;
+            cout << left << setw(28) << "AVX2 raise kernel" << simdMs << " ms"
+                 << (simdExact ? "  [bit-exact]" : "  [MISMATCH]") << "\n";
+
+            start = chrono::steady_clock::now();
+            double scalarSum = sumScalar(salaries.data(), n);
+            double scalarSumMs = elapsedMs(start);
+            start = chrono::steady_clock::now();
+            double simdSum = sumAvx2(salaries.data(), n);
+            double simdSumMs = elapsedMs(start);
+            allExact = allExact && scalarSum == simdSum;
+            cout << left << setw(28) << "Payroll sum (scalar)" << scalarSumMs << " ms\n";
+            cout << left << setw(28) << "Payroll sum (AVX2)" << simdSumMs << " ms"
+                 << (scalarSum == simdSum ? "  [matches scalar]" : "  [MISMATCH]") << "\n";
+
+            vector<size_t> scalarHist(10, 0), simdHist(10, 0);
+            start = chrono::steady_clock::now();
+            histogramScalar(salaries.data(), n, 25000.0, scalarHist);
+            double scalarHistMs = elapsedMs(start);
+            start = chrono::steady_clock::now();
+            histogramAvx2(salaries.data(), n, 25000.0, simdHist);
+            double simdHistMs = elapsedMs(start);
+            allExact = allExact && scalarHist == simdHist;
+            cout << left << setw(28) << "Histogram (scalar)" << scalarHistMs << " ms\n";
+            cout << left << setw(28) << "Histogram (AVX2)" << simdHistMs << " ms"
+                 << (scalarHist == simdHist ? "  [matches scalar]" : "  [MISMATCH]") << "\n";
+        } else {
+            cout << "AVX2 not supported on this CPU; scalar kernels only.\n";
+        }
+#endif
+        cout << "========================================\n";
+        return allExact;
+    }
+}
+
+// Readers scanning pinned snapshots while a writer keeps committing. Every
+// snapshot's checksum must equal the one recorded for its version, however
+// far the writer has moved on.
+namespace MvccBench {
+    struct Row {
+        int32_t id;
+        int32_t value;
+    };
+
+    inline bool run(size_t rows, size_t commits) {
+        const size_t READERS = 2;
+        EpochDomain domain;
+        VersionedTable<Row, 4096> table(domain);
+        long long sum = 0;
+        for (size_t i = 0; i < rows; i++) {
+            table.append(Row{(int32_t)i, 1});
+            sum += 1;
+        }
+        vector<long long> expected(commits + 2, 0);
+        expected[1] = sum;
+        table.commit();
+
+        atomic<bool> done(false);
+        atomic<size_t> scans(0), mismatches(0);
+        vector<thread> readers;
+        for (size_t r = 0; r < READERS; r++) {
+            readers.emplace_back([&]() {
+                while (!done.load()) {
+                    auto snap = table.snapshot();
+                    long long seen = 0;
+                    snap.forEach([&seen](const Row& row) { seen += row.value; });
+                    if (seen != expected[snap.number()]) mismatches++;
+                    scans++;
+                }
+            });
+        }
+
+        // Each commit updates one row and appends another
+        auto began = chrono::steady_clock::now();
+        unsigned seed = 12345;
+        for (size_t c = 0; c < commits; c++) {
+            seed = seed * 1103515245u + 12345u;
+            size_t row = (seed >> 8) % table.size();
+            auto snap = table.snapshot();
+            int32_t old = snap[row].value;
+            int32_t value = (int32_t)(seed % 100);
+            table.update(row, Row{(int32_t)row, value});
+            table.append(Row{(int32_t)(rows + c), 1});
+            sum += value - old + 1;
+            expected[snap.number() + 1] = sum;
+            table.commit();
+        }
+        double writeSeconds = chrono::duration<double>(chrono::steady_clock::now() - began).count();
+        done = true;
+        for (auto& t : readers) t.join();
+        domain.reclaim();
+
+        cout << "\n========================================\n";
+        cout << "        SNAPSHOT (MVCC) BENCHMARK\n";
+        cout << "========================================\n";
+        cout << "Rows: " << rows << " (+" << commits << " appended)\n";
+        cout << "Commits: " << commits << " in " << fixed << setprecision(1) << writeSeconds * 1000
+             << " ms (" << setprecision(0) << (writeSeconds > 0 ? commits / writeSeconds : 0)
+             << " commits/s) with " << READERS << " readers scanning\n";
+        cout << "Reader scans: " << scans.load() << ", checksum mismatches: " << mismatches.load() << endl;
+        cout << "Versions reclaimed: " << domain.reclaimedCount() << ", still pending: "
+             << domain.pendingCount() << endl;
+        cout << "========================================\n";
+        return mismatches.load() == 0;
+    }
+}
+
+void printUsage() {
+    cout << "Usage:\n";
+    cout << "  bench payroll [record count]\n";
+    cout << "  bench mvcc [rows] [commits]\n";
+}
+
+int main(int argc, char* argv[]) {
+    string command = argc > 1 ? argv[1] : "";
+    if (command == "payroll") {
+        long long n = argc > 2 ? atoll(argv[2]) : 1000000;
+        return PayrollBench::run(n > 0 ? (size_t)n : 1000000) ? 0 : 1;
+    }
+    if (command == "mvcc") {
+        long long rows = argc > 2 ? atoll(argv[2]) : 1000000;
+        long long commits = argc > 3 ? atoll(argv[3]) : 20000;
+        return MvccBench::run(rows > 0 ? (size_t)rows : 1000000, commits > 0 ? (size_t)commits : 20000) ? 0 : 1;
+    }
+    printUsage();
+    return command.empty() || command == "help" ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+#ifndef BLOB_STORE_H
+#define BLOB_STORE_H
+
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <charconv>
+#include <cstdint>
+using namespace std;
+
+// Where a text value lives in a BlobStore file; a zero length is the empty
+// string and touches no file.
+struct BlobRef {
+    uint64_t offset;
+    uint32_t length;
+
+    BlobRef() : offset(0), length(0) {}
+    BlobRef(uint64_t o, uint32_t l) : offset(o), length(l) {}
+
+    bool empty() const { return length == 0; }
+    bool operator==(const BlobRef& other) const { return offset == other.offset && length == other.length; }
+
+    // "offset:length" in record files; "" when empty
+    string toString() const {
+        return empty() ? "" : to_string(offset) + ":" + to_string(length);
+    }
+
+    static bool parse(string_view text, BlobRef& ref) {
+        ref = BlobRef();
+        if (text.empty()) return true;
+        size_t colon = text.find(':');
+        if (colon == string_view::npos) return false;
+        const char* end = text.data() + text.size();
+        auto a = from_chars(text.data(), text.data() + colon, ref.offset);
+        auto b = from_chars(text.data() + colon + 1, end, ref.length);
+        return a.ec == errc() && a.ptr == text.data() + colon && b.ec == errc() && b.ptr == end;
+    }
+};
+
+// Append-only file of large text values. put() writes the bytes at the end
+// and hands back their handle; get() reads just those bytes back. Values are
+// never rewritten in place, so a handle stays valid for the life of the
+// file and a record file only has to hold handles. Replaced values are left
+// behind as dead bytes.
+class BlobStore {
+private:
+    string path;
+    ofstream writer;
+    mutable ifstream reader;
+    uint64_t endOffset;
+
+public:
+    BlobStore() : endOffset(0) {}
+
+    // Opens (creating if needed) the file; later calls with the same path do nothing
+    bool open(const string& filePath) {
+        if (writer.is_open() && filePath == path) return true;
+        writer.close();
+        reader.close();
+        path = filePath;
+        writer.open(path, ios::binary | ios::app);
+        if (!writer.is_open()) return false;
+        writer.seekp(0, ios::end);
+        endOffset = (uint64_t)writer.tellp();
+        reader.open(path, ios::binary);
+        return reader.is_open();
+    }
+
+    bool isOpen() const { return writer.is_open(); }
+
+    // Written through before returning, so a record saved afterwards never
+    // points past the end of the file. False if the bytes did not reach the
+    // file; the store then stops accepting writes, since a partial write
+    // leaves the end offset unknown.
+    bool put(string_view text, BlobRef& ref) {
+        ref = BlobRef();
+        if (text.empty()) return true;
+        if (!writer.is_open()) return false;
+        writer.write(text.data(), (streamsize)text.size());
+        writer.flush();
+        if (!writer.good()) {
+            writer.close();
+            return false;
+        }
+        ref = BlobRef(endOffset, (uint32_t)text.size());
+        endOffset += text.size();
+        return true;
+    }
+
+    // False if the handle lies outside the file (out is then empty)
+    bool get(const BlobRef& ref, string& out) const {
+        out.clear();
+        if (ref.empty()) return true;
+        if (!reader.is_open() || ref.offset + ref.length > endOffset) return false;
+        out.resize(ref.length);
+        reader.clear();
+        reader.seekg((streamoff)ref.offset);
+        reader.read(&out[0], (streamsize)ref.length);
+        if (reader.gcount() != (streamsize)ref.length) {
+            out.clear();
+            return false;
+        }
+        return true;
+    }
+
+    string get(const BlobRef& ref) const {
+        string out;
+        get(ref, out);
+        return out;
+    }
+
+    uint64_t sizeOnDisk() const { return endOffset; }
+};
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef DATE_UTILS_H
+#define DATE_UTILS_H
+
+#include <string>
+#include <string_view>
+#include <cstdio>
+using namespace std;
+
+// Calendar helpers working on "day numbers" (days since 1970-01-01), so date
+// fields can be stored as plain integers and compared or subtracted directly.
+namespace DateUtils {
+
+    inline int daysFromCivil(int y, int m, int d) {
+        y -= m <= 2;
+        const int era = (y >= 0 ? y : y - 399) / 400;
+        const int yoe = y - era * 400;
+        const int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+    inline void civilFromDays(int z, int& y, int& m, int& d) {
+        z += 719468;
+        const int era = (z >= 0 ? z : z - 146096) / 146097;
+        const int doe = z - era * 146097;
+        const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const int mp = (5 * doy + 2) / 153;
+        d = doy - (153 * mp + 2) / 5 + 1;
+        m = mp + (mp < 10 ? 3 : -9);
+        y = yoe + era * 400 + (m <= 2);
+    }
+
+    inline bool isLeapYear(int y) {
+        return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    }
+
+    inline int daysInMonth(int y, int m) {
+        static const int days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return (m == 2 && isLeapYear(y)) ? 29 : days[m - 1];
+    }
+
+    // Strict "YYYY-MM-DD"; rejects anything else, including impossible dates.
+    inline bool parseDate(string_view text, int& dayNumber) {
+        if (text.size() < 10 || text[4] != '-' || text[7] != '-') return false;
+        for (int i : {0, 1, 2, 3, 5, 6, 8, 9}) {
+            if (text[i] < '0' || text[i] > '9') return false;
+        }
+        // Allow trailing time ("2025-11-24 22:58:15") but nothing else glued on
+        if (text.size() > 10 && text[10] != ' ') return false;
+        int y = (text[0] - '0') * 1000 + (text[1] - '0') * 100 + (text[2] - '0') * 10 + (text[3] - '0');
+        int m = (text[5] - '0') * 10 + (text[6] - '0');
+        int d = (text[8] - '0') * 10 + (text[9] - '0');
+        if (m < 1 || m > 12 || d < 1 || d > daysInMonth(y, m)) return false;
+        dayNumber = daysFromCivil(y, m, d);
+        return true;
+    }
+
+    inline string formatDate(int dayNumber) {
+        int y, m, d;
+        civilFromDays(dayNumber, y, m, d);
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", y, m, d);
+        return string(buffer);
+    }
+
+    inline int yearOf(int dayNumber) {
+        int y, m, d;
+        civilFromDays(dayNumber, y, m, d);
+        return y;
+    }
+
+    // 0-based day within its year (0..365)
+    inline int dayOfYear(int dayNumber) {
+        return dayNumber - daysFromCivil(yearOf(dayNumber), 1, 1);
+    }
+}
+
+#endif
@@ -8,6 +8,9 @@
 #include <ctime>
 #include <iomanip>
 #include <regex>
+#include "intern_pool.h"
+#include "record_parser.h"
+#include "blob_store.h"
 using namespace std;
 
 // Forward declarations
@@ -79,25 +82,26 @@ class Project {
 private:
     int projectId;
     string title;
-    string description;
-    string assignedTo;
+    BlobRef description; // long text lives in the project blob file
+    Symbol assignedTo;
     int employeeId;
     string deadline;
-    string status; // "Assigned", "Submitted", "Feedback", "Completed"
-    string feedback;
-    string submissionContent;
+    Symbol status; // "Assigned", "Submitted", "Feedback", "Completed"
+    BlobRef feedback;
+    BlobRef submissionContent;
     string submissionDate;
-    string projectType; // "Minor", "Major", "Urgent", "Long-term"
+    Symbol projectType; // "Minor", "Major", "Urgent", "Long-term"
+    BlobStore* blobs; // holds the BlobRef fields; not owned
 
 public:
-    Project() : projectId(0), employeeId(0), status("Assigned") {}
-    Project(int pid, string t, string desc, string emp, int eid, string dl, string type)
+    Project() : projectId(0), employeeId(0), status("Assigned"), blobs(nullptr) {}
+    Project(int pid, string t, BlobRef desc, string emp, int eid, string dl, string type, BlobStore* store)
         : projectId(pid), title(t), description(desc), assignedTo(emp),
-          employeeId(eid), deadline(dl), status("Assigned"), projectType(type) {}
+          employeeId(eid), deadline(dl), status("Assigned"), projectType(type), blobs(store) {}
 
     ~Project() { /* cout << "Project destructor: " << title << endl; */ }
 
-    // Copy constructor
+    // Copy constructor (handles only; the text stays in the blob file)
     Project(const Project& p) {
         projectId = p.projectId;
         title = p.title;
@@ -110,6 +114,7 @@ public:
         submissionContent = p.submissionContent;
         submissionDate = p.submissionDate;
         projectType = p.projectType;
+        blobs = p.blobs;
     }
 
     // Assignment operator overloading
@@ -126,27 +131,36 @@ public:
             submissionContent = p.submissionContent;
             submissionDate = p.submissionDate;
             projectType = p.projectType;
+            blobs = p.blobs;
         }
         return *this;
     }
 
-    // Getters
+    void attachBlobs(BlobStore* store) { blobs = store; }
+
+    // Getters; the long fields are read from the blob file on each call
     int getProjectId() const { return projectId; }
     string getTitle() const { return title; }
-    string getDescription() const { return description; }
-    string getAssignedTo() const { return assignedTo; }
+    string getDescription() const { return fetch(description); }
+    BlobRef getDescriptionRef() const { return description; }
+    string getAssignedTo() const { return assignedTo.str(); }
+    Symbol getAssignedToSymbol() const { return assignedTo; }
     int getEmployeeId() const { return employeeId; }
     string getDeadline() const { return deadline; }
-    string getStatus() const { return status; }
-    string getFeedback() const { return feedback; }
-    string getSubmissionContent() const { return submissionContent; }
+    string getStatus() const { return status.str(); }
+    Symbol getStatusSymbol() const { return status; }
+    string getFeedback() const { return fetch(feedback); }
+    bool hasFeedback() const { return !feedback.empty(); }
+    string getSubmissionContent() const { return fetch(submissionContent); }
     string getSubmissionDate() const { return submissionDate; }
-    string getProjectType() const { return projectType; }
-
-    // Setters
-    void setStatus(string s) { status = s; }
-    void setFeedback(string f) { feedback = f; }
-    void setSubmissionContent(string s) { submissionContent = s; }
+    string getProjectType() const { return projectType.str(); }
+    Symbol getProjectTypeSymbol() const { return projectType; }
+
+    // Setters; new text is appended to the blob file (false, and the old
+    // text kept, if it could not be written)
+    void setStatus(Symbol s) { status = s; }
+    bool setFeedback(string f) { return store(f, feedback); }
+    bool setSubmissionContent(string s) { return store(s, submissionContent); }
     void setSubmissionDate(string d) { submissionDate = d; }
 
     void display() const {
@@ -154,55 +168,73 @@ public:
         cout << "Project ID: " << projectId << endl;
         cout << "Title: " << title << endl;
         cout << "Type: " << projectType << endl;
-        cout << "Description: " << description << endl;
+        cout << "Description: " << getDescription() << endl;
         cout << "Assigned To: " << assignedTo << " (ID: " << employeeId << ")" << endl;
         cout << "Deadline: " << deadline << endl;
         cout << "Status: " << status << endl;
-        if (status == "Submitted" || status == "Feedback" || status == "Completed") {
+        const string& statusText = status.str();
+        if (statusText == "Submitted" || statusText == "Feedback" || statusText == "Completed") {
             cout << "Submission Date: " << submissionDate << endl;
         }
-        if (feedback != "") {
-            cout << "Feedback: " << feedback << endl;
+        if (hasFeedback()) {
+            cout << "Feedback: " << getFeedback() << endl;
         }
         cout << "=====================================\n";
     }
 
+    // The trailing "blob" field marks the long fields as blob handles
     void saveToFile(ofstream& out) const {
-        out << projectId << "|" << title << "|" << description << "|"
+        out << projectId << "|" << title << "|" << description.toString() << "|"
             << assignedTo << "|" << employeeId << "|" << deadline << "|"
-            << status << "|" << feedback << "|" << submissionContent << "|"
-            << submissionDate << "|" << projectType << "\n";
+            << status << "|" << feedback.toString() << "|" << submissionContent.toString() << "|"
+            << submissionDate << "|" << projectType << "|blob\n";
     }
 
     bool loadFromFile(ifstream& in) {
         string line;
         if (getline(in, line)) {
-            size_t pos = 0;
-            string delimiter = "|";
-            vector<string> tokens;
-            while ((pos = line.find(delimiter)) != string::npos) {
-                tokens.push_back(line.substr(0, pos));
-                line.erase(0, pos + delimiter.length());
-            }
-            tokens.push_back(line);
-
-            if (tokens.size() >= 11) {
-                projectId = stoi(tokens[0]);
-                title = tokens[1];
-                description = tokens[2];
-                assignedTo = tokens[3];
-                employeeId = stoi(tokens[4]);
-                deadline = tokens[5];
-                status = tokens[6];
-                feedback = tokens[7];
-                submissionContent = tokens[8];
-                submissionDate = tokens[9];
-                projectType = tokens[10];
-                return true;
-            }
+            return loadFromLine(line);
         }
         return false;
     }
+
+    // Older files hold the long fields inline; those are copied into the
+    // blob file as they load and *migrated is set so the caller can save
+    // the record in the new form. Such a record fails to load if the blob
+    // file cannot take the texts.
+    bool loadFromLine(string_view line, bool* migrated = nullptr) {
+        string_view f[12];
+        size_t count = RecordParser::splitFields(line, f, 12);
+        if (count < 11) return false;
+        if (!RecordParser::parseInt(f[0], projectId) || !RecordParser::parseInt(f[4], employeeId)) return false;
+        title.assign(f[1]);
+        assignedTo = f[3];
+        deadline.assign(f[5]);
+        status = f[6];
+        submissionDate.assign(f[9]);
+        projectType = f[10];
+        if (count >= 12 && f[11] == "blob") {
+            return BlobRef::parse(f[2], description) && BlobRef::parse(f[7], feedback) &&
+                   BlobRef::parse(f[8], submissionContent);
+        }
+        if (!store(f[2], description) || !store(f[7], feedback) || !store(f[8], submissionContent)) {
+            return false;
+        }
+        if (migrated) *migrated = true;
+        return true;
+    }
+
+private:
+    string fetch(const BlobRef& ref) const {
+        return blobs ? blobs->get(ref) : string();
+    }
+
+    bool store(string_view text, BlobRef& ref) {
+        BlobRef written;
+        if (!blobs || !blobs->put(text, written)) return false;
+        ref = written;
+        return true;
+    }
 };
 
 // Attendance class
@@ -232,25 +264,19 @@ public:
     bool loadFromFile(ifstream& in) {
         string line;
         if (getline(in, line)) {
-            size_t pos = 0;
-            string delimiter = "|";
-            vector<string> tokens;
-            while ((pos = line.find(delimiter)) != string::npos) {
-                tokens.push_back(line.substr(0, pos));
-                line.erase(0, pos + delimiter.length());
-            }
-            tokens.push_back(line);
-
-            if (tokens.size() >= 4) {
-                employeeId = stoi(tokens[0]);
-                date = tokens[1];
-                present = (tokens[2] == "1");
-                overtimeHours = stoi(tokens[3]);
-                return true;
-            }
+            return loadFromLine(line);
         }
         return false;
     }
+
+    bool loadFromLine(string_view line) {
+        string_view f[4];
+        if (RecordParser::splitFields(line, f, 4) < 4) return false;
+        if (!RecordParser::parseInt(f[0], employeeId) || !RecordParser::parseInt(f[3], overtimeHours)) return false;
+        date.assign(f[1]);
+        present = (f[2] == "1");
+        return true;
+    }
 };
 
 // Performance class
@@ -322,42 +348,37 @@ public:
     bool loadFromFile(ifstream& in) {
         string line;
         if (getline(in, line)) {
-            size_t pos = 0;
-            string delimiter = "|";
-            vector<string> tokens;
-            while ((pos = line.find(delimiter)) != string::npos) {
-                tokens.push_back(line.substr(0, pos));
-                line.erase(0, pos + delimiter.length());
-            }
-            tokens.push_back(line);
-
-            if (tokens.size() >= 7) {
-                employeeId = stoi(tokens[0]);
-                attendancePercentage = stod(tokens[1]);
-                totalOvertimeHours = stoi(tokens[2]);
-                projectsCompleted = stoi(tokens[3]);
-                onTimeSubmissions = stoi(tokens[4]);
-                performanceScore = stod(tokens[5]);
-                performanceGrade = tokens[6];
-                return true;
-            }
+            return loadFromLine(line);
         }
         return false;
     }
+
+    bool loadFromLine(string_view line) {
+        string_view f[7];
+        if (RecordParser::splitFields(line, f, 7) < 7) return false;
+        if (!RecordParser::parseInt(f[0], employeeId) ||
+            !RecordParser::parseDouble(f[1], attendancePercentage) ||
+            !RecordParser::parseInt(f[2], totalOvertimeHours) ||
+            !RecordParser::parseInt(f[3], projectsCompleted) ||
+            !RecordParser::parseInt(f[4], onTimeSubmissions) ||
+            !RecordParser::parseDouble(f[5], performanceScore)) return false;
+        performanceGrade.assign(f[6]);
+        return true;
+    }
 };
 
 // Employee class (inherits from Person)
 class Employee : public Person {
 private:
-    string department;
-    string position;
+    Symbol department;
+    Symbol position;
     double salary;
     string joiningDate;
     string password;
     vector<int> assignedProjectIds;
 
 public:
-    Employee() : Person(), department(""), position(""), salary(0), joiningDate("") {}
+    Employee() : Person(), salary(0), joiningDate("") {}
 
     Employee(string n, string e, string p, int i, string dept, string pos, double sal, string jd, string pass)
         : Person(n, e, p, i), department(dept), position(pos), salary(sal), joiningDate(jd), password(pass) {}
@@ -404,12 +425,15 @@ public:
     }
 
     // Getters
-    string getDepartment() const { return department; }
-    string getPosition() const { return position; }
+    string getDepartment() const { return department.str(); }
+    string getPosition() const { return position.str(); }
+    Symbol getDepartmentSymbol() const { return department; }
+    Symbol getPositionSymbol() const { return position; }
     double getSalary() const { return salary; }
     string getJoiningDate() const { return joiningDate; }
     string getPassword() const { return password; }
     vector<int> getAssignedProjectIds() const { return assignedProjectIds; }
+    size_t getProjectCount() const { return assignedProjectIds.size(); }
 
     // Setters
     void setDepartment(string d) { department = d; }
@@ -443,40 +467,60 @@ public:
     bool loadFromFile(ifstream& in) {
         string line;
         if (getline(in, line)) {
-            size_t pos = 0;
-            string delimiter = "|";
-            vector<string> tokens;
-            while ((pos = line.find(delimiter)) != string::npos) {
-                tokens.push_back(line.substr(0, pos));
-                line.erase(0, pos + delimiter.length());
-            }
-            tokens.push_back(line);
-
-            if (tokens.size() >= 10) {
-                id = stoi(tokens[0]);
-                name = tokens[1];
-                email = tokens[2];
-                phone = tokens[3];
-                department = tokens[4];
-                position = tokens[5];
-                salary = stod(tokens[6]);
-                joiningDate = tokens[7];
-                password = tokens[8];
-
-                if (tokens[9] != "") {
-                    string projIds = tokens[9];
-                    size_t p = 0;
-                    while ((p = projIds.find(",")) != string::npos) {
-                        assignedProjectIds.push_back(stoi(projIds.substr(0, p)));
-                        projIds.erase(0, p + 1);
-                    }
-                    if (projIds != "") assignedProjectIds.push_back(stoi(projIds));
-                }
-                return true;
-            }
+            return loadFromLine(line);
         }
         return false;
     }
+
+    bool loadFromLine(string_view line) {
+        string_view f[10];
+        if (RecordParser::splitFields(line, f, 10) < 10) return false;
+        if (!RecordParser::parseInt(f[0], id) || !RecordParser::parseDouble(f[6], salary)) return false;
+        name.assign(f[1]);
+        email.assign(f[2]);
+        phone.assign(f[3]);
+        department = f[4];
+        position = f[5];
+        joiningDate.assign(f[7]);
+        password.assign(f[8]);
+
+        // Replace, not append: the same object may be reused across lines
+        assignedProjectIds.clear();
+        string_view projIds = f[9];
+        while (!projIds.empty()) {
+            size_t comma = projIds.find(',');
+            string_view piece = projIds.substr(0, comma);
+            int pid;
+            if (!piece.empty()) {
+                if (!RecordParser::parseInt(piece, pid)) return false;
+                assignedProjectIds.push_back(pid);
+            }
+            if (comma == string_view::npos) break;
+            projIds.remove_prefix(comma + 1);
+        }
+        return true;
+    }
+};
+
+// Plain copy of an employee for versioned snapshots: no destructor logging,
+// cheap to copy a chunk at a time
+struct EmployeeSnapshotRow {
+    int id;
+    string name;
+    string email;
+    string phone;
+    Symbol department;
+    Symbol position;
+    double salary;
+    string joiningDate;
+    int projectCount;
+
+    EmployeeSnapshotRow() : id(0), salary(0), projectCount(0) {}
+    explicit EmployeeSnapshotRow(const Employee& emp)
+        : id(emp.getId()), name(emp.getName()), email(emp.getEmail()), phone(emp.getPhone()),
+          department(emp.getDepartmentSymbol()), position(emp.getPositionSymbol()),
+          salary(emp.getSalary()), joiningDate(emp.getJoiningDate()),
+          projectCount((int)emp.getProjectCount()) {}
 };
 
 #endif
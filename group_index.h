@@ -0,0 +1,101 @@
+#ifndef GROUP_INDEX_H
+#define GROUP_INDEX_H
+
+#include <string>
+#include <map>
+#include <set>
+#include <vector>
+using namespace std;
+
+// Secondary index grouping employee IDs by a string key (department,
+// position, ...) with per-group salary aggregates maintained incrementally,
+// so headcount/payroll questions never scan the employee list.
+class GroupIndex {
+public:
+    struct GroupStats {
+        int count;
+        double totalSalary;
+        double minSalary;
+        double maxSalary;
+        double meanSalary() const { return count > 0 ? totalSalary / count : 0.0; }
+    };
+
+private:
+    struct Group {
+        set<int> members;
+        double totalSalary;
+        multiset<double> salaries; // ordered, for min/max under removal
+        Group() : totalSalary(0) {}
+    };
+
+    map<string, Group> groups;
+
+    static const set<int>& emptyMembers() {
+        static const set<int> empty;
+        return empty;
+    }
+
+public:
+    GroupIndex() {}
+
+    void add(const string& key, int id, double salary) {
+        Group& g = groups[key];
+        if (!g.members.insert(id).second) return;
+        g.totalSalary += salary;
+        g.salaries.insert(salary);
+    }
+
+    void remove(const string& key, int id, double salary) {
+        auto it = groups.find(key);
+        if (it == groups.end() || it->second.members.erase(id) == 0) return;
+        Group& g = it->second;
+        g.totalSalary -= salary;
+        auto s = g.salaries.find(salary);
+        if (s != g.salaries.end()) g.salaries.erase(s);
+        if (g.members.empty()) groups.erase(it);
+    }
+
+    void move(const string& oldKey, const string& newKey, int id, double salary) {
+        if (oldKey == newKey) return;
+        remove(oldKey, id, salary);
+        add(newKey, id, salary);
+    }
+
+    void updateSalary(const string& key, int id, double oldSalary, double newSalary) {
+        auto it = groups.find(key);
+        if (it == groups.end() || it->second.members.count(id) == 0) return;
+        Group& g = it->second;
+        g.totalSalary += newSalary - oldSalary;
+        auto s = g.salaries.find(oldSalary);
+        if (s != g.salaries.end()) g.salaries.erase(s);
+        g.salaries.insert(newSalary);
+    }
+
+    void clear() { groups.clear(); }
+
+    bool getStats(const string& key, GroupStats& out) const {
+        auto it = groups.find(key);
+        if (it == groups.end()) return false;
+        const Group& g = it->second;
+        out.count = (int)g.members.size();
+        out.totalSalary = g.totalSalary;
+        out.minSalary = *g.salaries.begin();
+        out.maxSalary = *g.salaries.rbegin();
+        return true;
+    }
+
+    const set<int>& getMembers(const string& key) const {
+        auto it = groups.find(key);
+        return it == groups.end() ? emptyMembers() : it->second.members;
+    }
+
+    vector<string> getKeys() const {
+        vector<string> keys;
+        for (const auto& entry : groups) keys.push_back(entry.first);
+        return keys;
+    }
+
+    size_t getGroupCount() const { return groups.size(); }
+};
+
+#endif
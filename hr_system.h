@@ -3,39 +3,181 @@
 
 #include "employee.h"
 #include "hrmanager.h"
+#include "task_pool.h"
+#include "text_index.h"
+#include "name_trie.h"
+#include "group_index.h"
+#include "payroll_kernels.h"
+#include "attendance_store.h"
+#include "attendance_calendar.h"
+#include "leaderboard.h"
+#include "interval_tree.h"
+#include "leave_ledger.h"
+#include "recruitment_funnel.h"
+#include "notice_feed.h"
+#include "roaring_bitmap.h"
+#include "mail_queue.h"
+#include "query_engine.h"
+#include "report_export.h"
+#include "mvcc.h"
 #include <map>
 #include <ctime>
+#include <chrono>
+#include <functional>
 
 class HRSystem {
 private:
     vector<Employee> employees;
     string hrPassword; // Single fixed HR password
     vector<Project> projects;
-    vector<Attendance> attendanceRecords;
-    vector<Notice> notices;
+    BlobStore projectBlobs; // descriptions, feedback and submissions of projects
+    LoadArena attendanceArena; // holds the loaded attendance columns; must outlive the store
+    AttendanceStore attendanceStore; // columnar; Attendance is only the file format
+    AttendanceCalendar attendanceCalendar; // per-employee yearly bitmaps derived from it
+    size_t attendanceRowsOnDisk; // leading store rows known to match attendance.dat
+    vector<Notice> notices; // hot set, in ID (posting) order
     vector<Candidate> candidates;
     vector<LeaveRequest> leaveRequests;
     map<int, Performance> performanceMap;
 
+    // Full-text indexes, keyed by noticeId / projectId
+    TextIndex noticeIndex;
+    TextIndex projectIndex;
+
+    // Newest-first paging over notices, overall and per type
+    NoticeFeed noticeFeed;
+
+    // Read receipts: noticeId -> employees who have seen it, plus the set of
+    // all employee IDs to take "not read" differences against
+    unordered_map<int, RoaringBitmap> noticeReads;
+    RoaringBitmap employeeIdSet;
+    // empId -> board notices they have read, counted on their first unread
+    // query and then kept current by markNoticeRead. Unread is the board size
+    // minus this, so posting needs no update; archiving and reloading drop it.
+    unordered_map<int, size_t> noticesReadCount;
+
+    // Outbound mail; sent by its own background thread
+    MailQueue mailQueue;
+
+    // Name/email trie over employees, for lookups without a numeric ID
+    NameTrie employeeNameIndex;
+
+    // Department/position -> employees, with running salary aggregates
+    GroupIndex departmentIndex;
+    GroupIndex positionIndex;
+
+    // Columnar copy of employee IDs/salaries; row i mirrors employees[i]
+    SalaryColumn salaryColumn;
+
+    // ID -> position in employees / projects / leaveRequests (all append-only)
+    unordered_map<int, size_t> employeeRowById;
+    unordered_map<int, size_t> projectRowById;
+    unordered_map<int, size_t> leaveRowById;
+    // Project rows by Project::employeeId, the source of truth for ownership
+    unordered_map<int, vector<size_t>> projectRowsByEmployee;
+
+    // Point-in-time versions of employees and the attendance log for long
+    // readers (exports); built on first use, then committed after each write
+    typedef VersionedTable<EmployeeSnapshotRow, 1024> EmployeeVersions;
+    typedef VersionedTable<AttendanceSnapshotRow, 8192> AttendanceVersions;
+    EpochDomain snapshotEpochs;
+    EmployeeVersions employeeVersions;
+    AttendanceVersions attendanceVersions;
+    bool employeeVersionsBuilt;
+    bool attendanceVersionsBuilt;
+
+    // Performance ranking; mirrors performanceMap
+    Leaderboard leaderboard;
+
+    // Pending and approved leave with valid YYYY-MM-DD dates, by day range
+    IntervalTree leaveCalendar;
+
+    // Accruals and approved leave per employee; built on first use from
+    // employees + leave requests, then kept current incrementally
+    LeaveLedger leaveLedger;
+    bool leaveLedgerBuilt;
+
+    // Normalized candidate email -> candidate ID (first record wins for
+    // legacy duplicates), and per-position x per-status candidate counts
+    unordered_map<string, int> candidateEmailIndex;
+    RecruitmentFunnel recruitmentFunnel;
+
+    // Normalized employee email / phone -> number of employees using it.
+    // Counts rather than sets, since employees.dat already has duplicates.
+    unordered_map<string, int> employeeEmailCounts;
+    unordered_map<string, int> employeePhoneCounts;
+
     int nextEmployeeId;
     int nextProjectId;
     int nextNoticeId;
     int nextCandidateId;
     int nextLeaveRequestId;
 
+    // Dirty flags: set by mutators, cleared once the collection is written,
+    // so saveAllData only rewrites files whose contents actually changed.
+    bool employeesDirty;
+    bool hrPasswordDirty;
+    bool projectsDirty;
+    bool attendanceDirty;
+    bool noticesDirty;
+    bool candidatesDirty;
+    bool leaveRequestsDirty;
+    bool performanceDirty;
+    bool noticeReadsDirty;
+
+    // Loaded flags: each collection is read from disk on first access, so
+    // startup only pays for the files the current code path actually uses.
+    bool employeesLoaded;
+    bool hrPasswordLoaded;
+    bool projectsLoaded;
+    bool attendanceLoaded;
+    bool noticesLoaded;
+    bool candidatesLoaded;
+    bool leaveRequestsLoaded;
+    bool performanceLoaded;
+
+    // Per-file wall time (ms) of the last loadAllData call, plus its total.
+    map<string, double> loadTimings;
+    double lastLoadWallMs;
+
     const string EMPLOYEE_FILE = "employees.dat";
     const string HR_FILE = "hr_password.dat";
     const string PROJECT_FILE = "projects.dat";
     const string ATTENDANCE_FILE = "attendance.dat";
     const string NOTICE_FILE = "notices.dat";
+    const string NOTICE_ARCHIVE_FILE = "notices_archive.dat";
+    const string NOTICE_READS_FILE = "notice_reads.dat";
+    const string MAIL_QUEUE_FILE = "mail_queue.dat";
+    const string MAIL_FAILED_FILE = "mail_failed.dat";
+    const string MAIL_CONFIG_FILE = "mail_relay.conf";
     const string CANDIDATE_FILE = "candidates.dat";
     const string LEAVE_FILE = "leave_requests.dat";
     const string PERFORMANCE_FILE = "performance.dat";
+    const string PROJECT_BLOB_FILE = "project_blobs.dat";
+
+    // attendance.dat is parsed in chunks of roughly this size in parallel
+    const size_t ATTENDANCE_CHUNK_BYTES = 1 << 20;
+    const size_t SEARCH_RESULT_LIMIT = 10;
+    const double SALARY_BUCKET_WIDTH = 10000;
+    const size_t SALARY_BUCKET_COUNT = 10;
+    const int LEAVE_COVERAGE_MAX_DAYS = 366;
+    const size_t NOTICE_PAGE_SIZE = 5;
+    const size_t NOTICE_UNREAD_LIST_LIMIT = 20;
+    const size_t QUERY_RESULT_LIMIT = 50;
+    static constexpr double LEAVE_DAYS_PER_MONTH = 1.5;
 
 public:
-    HRSystem() : hrPassword(""), nextEmployeeId(1001), nextProjectId(2001),
-                 nextNoticeId(3001), nextCandidateId(4001), nextLeaveRequestId(5001) {
-        loadAllData();
+    HRSystem() : hrPassword(""), attendanceStore(attendanceArena.resource()), attendanceRowsOnDisk(0),
+                 employeeVersions(snapshotEpochs), attendanceVersions(snapshotEpochs),
+                 employeeVersionsBuilt(false), attendanceVersionsBuilt(false),
+                 leaveLedger(LEAVE_DAYS_PER_MONTH), leaveLedgerBuilt(false), nextEmployeeId(1001), nextProjectId(2001),
+                 nextNoticeId(3001), nextCandidateId(4001), nextLeaveRequestId(5001),
+                 employeesDirty(false), hrPasswordDirty(false), projectsDirty(false),
+                 attendanceDirty(false), noticesDirty(false), candidatesDirty(false),
+                 leaveRequestsDirty(false), performanceDirty(false), noticeReadsDirty(false),
+                 employeesLoaded(false), hrPasswordLoaded(false), projectsLoaded(false),
+                 attendanceLoaded(false), noticesLoaded(false), candidatesLoaded(false),
+                 leaveRequestsLoaded(false), performanceLoaded(false), lastLoadWallMs(0) {
     }
 
     ~HRSystem() {
@@ -73,6 +215,7 @@ public:
 
     // HR Authentication - Single password only
     bool authenticateHR(string password) {
+        ensureHRPasswordLoaded();
         if (hrPassword.empty()) {
             return false;
         }
@@ -80,17 +223,21 @@ public:
     }
 
     bool isHRPasswordSet() {
+        ensureHRPasswordLoaded();
         return !hrPassword.empty();
     }
 
     void setHRPassword(string password) {
         hrPassword = password;
+        hrPasswordLoaded = true;
+        hrPasswordDirty = true;
         saveHRPassword();
         cout << "\nHR Password set successfully!\n";
     }
 
     // Employee Management
     Employee* authenticateEmployee(int id, string password) {
+        ensureEmployeesLoaded();
         for (size_t i = 0; i < employees.size(); i++) {
             if (employees[i].getId() == id && employees[i].getPassword() == password) {
                 return &employees[i];
@@ -114,23 +261,250 @@ public:
             return;
         }
 
+        ensureEmployeesLoaded();
+        if (isEmployeeEmailTaken(email)) {
+            cout << "Error: Email already registered to another employee!\n";
+            return;
+        }
+        if (isEmployeePhoneTaken(phone)) {
+            cout << "Error: Phone already registered to another employee!\n";
+            return;
+        }
         Employee emp(name, email, phone, nextEmployeeId++, dept, position,
                      salary, getCurrentDate(), password);
+        employeeRowById.emplace(emp.getId(), employees.size());
         employees.push_back(emp);
+        salaryColumn.add(emp.getId(), emp.getSalary());
+        indexEmployeeName(emp);
+        indexEmployeeContact(emp);
+        employeeIdSet.add((uint32_t)emp.getId());
+        departmentIndex.add(dept, emp.getId(), salary);
+        positionIndex.add(position, emp.getId(), salary);
+        if (leaveLedgerBuilt) openLeaveAccount(emp);
+        stageEmployeeVersion(employees.back());
+        commitEmployeeVersion();
+        employeesDirty = true;
         saveEmployees();
         cout << "\nEmployee registered successfully! ID: " << emp.getId() << endl;
     }
 
     Employee* findEmployeeById(int id) {
-        for (size_t i = 0; i < employees.size(); i++) {
-            if (employees[i].getId() == id) {
-                return &employees[i];
+        ensureEmployeesLoaded();
+        auto it = employeeRowById.find(id);
+        return it == employeeRowById.end() ? nullptr : &employees[it->second];
+    }
+
+    // Indexes the full name, each word of it, the email and its local part,
+    // so "smith", "john smith" and "jsmith@" style lookups all hit.
+    void indexEmployeeName(const Employee& emp) {
+        const string name = emp.getName();
+        employeeNameIndex.insert(name, emp.getId());
+        size_t start = 0;
+        while (start < name.size()) {
+            size_t end = name.find(' ', start);
+            if (end == string::npos) end = name.size();
+            if (end > start && (start > 0 || end < name.size())) {
+                employeeNameIndex.insert(name.substr(start, end - start), emp.getId());
             }
+            start = end + 1;
         }
-        return nullptr;
+        const string email = emp.getEmail();
+        employeeNameIndex.insert(email, emp.getId());
+        size_t at = email.find('@');
+        if (at != string::npos) employeeNameIndex.insert(email.substr(0, at), emp.getId());
+    }
+
+    // Prefix and typo-tolerant search over employee names and emails.
+    // Returns (employeeId, edit distance) pairs, closest first.
+    vector<pair<int, int>> searchEmployeesByName(string query, size_t limit = 20) {
+        ensureEmployeesLoaded();
+        return employeeNameIndex.search(query, NameTrie::defaultMaxEdits(query), limit);
+    }
+
+    void displayEmployeeSearch(string query) {
+        vector<pair<int, int>> hits = searchEmployeesByName(query);
+        if (hits.empty()) {
+            cout << "\nNo matching employees found.\n";
+            return;
+        }
+
+        cout << "\n================================================\n";
+        cout << "           EMPLOYEE SEARCH RESULTS\n";
+        cout << "================================================\n";
+        cout << left << setw(8) << "ID" << setw(20) << "Name" << setw(25) << "Email"
+             << setw(15) << "Department" << "Edits" << endl;
+        cout << "------------------------------------------------\n";
+        for (const auto& hit : hits) {
+            auto it = employeeRowById.find(hit.first);
+            if (it == employeeRowById.end()) continue;
+            const Employee& emp = employees[it->second];
+            cout << left << setw(8) << emp.getId() << setw(20) << emp.getName()
+                 << setw(25) << emp.getEmail() << setw(15) << emp.getDepartment()
+                 << hit.second << endl;
+        }
+        cout << "================================================\n";
+    }
+
+    // Contact Uniqueness
+    static string normalizePhone(const string& phone) {
+        string digits;
+        for (char ch : phone) {
+            if (ch >= '0' && ch <= '9') digits += ch;
+        }
+        return digits;
+    }
+
+    bool isEmployeeEmailTaken(const string& email) {
+        ensureEmployeesLoaded();
+        auto it = employeeEmailCounts.find(normalizeEmail(email));
+        return it != employeeEmailCounts.end() && it->second > 0;
+    }
+
+    bool isEmployeePhoneTaken(const string& phone) {
+        ensureEmployeesLoaded();
+        auto it = employeePhoneCounts.find(normalizePhone(phone));
+        return it != employeePhoneCounts.end() && it->second > 0;
+    }
+
+    void indexEmployeeContact(const Employee& emp) {
+        employeeEmailCounts[normalizeEmail(emp.getEmail())]++;
+        employeePhoneCounts[normalizePhone(emp.getPhone())]++;
+    }
+
+    static void releaseKey(unordered_map<string, int>& counts, const string& key) {
+        auto it = counts.find(key);
+        if (it != counts.end() && --it->second <= 0) counts.erase(it);
+    }
+
+    // Person::setEmail validates the format; this wrapper also enforces
+    // uniqueness and keeps the contact and name indexes in step.
+    bool updateEmployeeEmail(int empId, string email) {
+        Employee* emp = findEmployeeById(empId);
+        if (!emp) {
+            cout << "Employee not found!\n";
+            return false;
+        }
+        string oldEmail = emp->getEmail();
+        if (normalizeEmail(oldEmail) != normalizeEmail(email) && isEmployeeEmailTaken(email)) {
+            cout << "Error: Email already registered to another employee!\n";
+            return false;
+        }
+        if (!emp->setEmail(email)) {
+            cout << "Error: Invalid email format!\n";
+            return false;
+        }
+        releaseKey(employeeEmailCounts, normalizeEmail(oldEmail));
+        employeeEmailCounts[normalizeEmail(email)]++;
+        employeeNameIndex.remove(oldEmail, empId);
+        size_t at = oldEmail.find('@');
+        if (at != string::npos) employeeNameIndex.remove(oldEmail.substr(0, at), empId);
+        indexEmployeeName(*emp);
+        stageEmployeeVersion(*emp);
+        commitEmployeeVersion();
+        employeesDirty = true;
+        saveEmployees();
+        cout << "\nEmail updated!\n";
+        return true;
+    }
+
+    bool updateEmployeePhone(int empId, string phone) {
+        Employee* emp = findEmployeeById(empId);
+        if (!emp) {
+            cout << "Employee not found!\n";
+            return false;
+        }
+        string oldPhone = emp->getPhone();
+        if (normalizePhone(oldPhone) != normalizePhone(phone) && isEmployeePhoneTaken(phone)) {
+            cout << "Error: Phone already registered to another employee!\n";
+            return false;
+        }
+        if (!emp->setPhone(phone)) {
+            cout << "Error: Invalid phone format!\n";
+            return false;
+        }
+        releaseKey(employeePhoneCounts, normalizePhone(oldPhone));
+        employeePhoneCounts[normalizePhone(phone)]++;
+        stageEmployeeVersion(*emp);
+        commitEmployeeVersion();
+        employeesDirty = true;
+        saveEmployees();
+        cout << "\nPhone updated!\n";
+        return true;
+    }
+
+    // Department/position changes go through HRSystem so the group
+    // indexes stay in step with Employee::setDepartment/setPosition.
+    bool updateEmployeeDepartment(int empId, string dept) {
+        Employee* emp = findEmployeeById(empId);
+        if (!emp) {
+            cout << "Employee not found!\n";
+            return false;
+        }
+        departmentIndex.move(emp->getDepartment(), dept, empId, emp->getSalary());
+        emp->setDepartment(dept);
+        stageEmployeeVersion(*emp);
+        commitEmployeeVersion();
+        employeesDirty = true;
+        saveEmployees();
+        cout << "\nDepartment updated!\n";
+        return true;
+    }
+
+    bool updateEmployeePosition(int empId, string position) {
+        Employee* emp = findEmployeeById(empId);
+        if (!emp) {
+            cout << "Employee not found!\n";
+            return false;
+        }
+        positionIndex.move(emp->getPosition(), position, empId, emp->getSalary());
+        emp->setPosition(position);
+        stageEmployeeVersion(*emp);
+        commitEmployeeVersion();
+        employeesDirty = true;
+        saveEmployees();
+        cout << "\nPosition updated!\n";
+        return true;
+    }
+
+    bool getDepartmentStats(string dept, GroupIndex::GroupStats& out) {
+        ensureEmployeesLoaded();
+        return departmentIndex.getStats(dept, out);
+    }
+
+    bool getPositionStats(string position, GroupIndex::GroupStats& out) {
+        ensureEmployeesLoaded();
+        return positionIndex.getStats(position, out);
+    }
+
+    // Headcount and payroll per department (or per position), answered from
+    // the maintained group totals without touching the employee records.
+    void displayGroupSummary(bool byDepartment) {
+        ensureEmployeesLoaded();
+        const GroupIndex& index = byDepartment ? departmentIndex : positionIndex;
+        if (index.getGroupCount() == 0) {
+            cout << "\nNo employees found.\n";
+            return;
+        }
+
+        cout << "\n============================================================\n";
+        cout << "        HEADCOUNT & PAYROLL BY " << (byDepartment ? "DEPARTMENT" : "POSITION") << "\n";
+        cout << "============================================================\n";
+        cout << left << setw(15) << (byDepartment ? "Department" : "Position") << setw(7) << "Count"
+             << setw(14) << "Total" << setw(12) << "Mean" << setw(12) << "Min"
+             << setw(12) << "Max" << endl;
+        cout << "------------------------------------------------------------\n";
+        for (const auto& key : index.getKeys()) {
+            GroupIndex::GroupStats stats;
+            if (!index.getStats(key, stats)) continue;
+            cout << left << setw(15) << key << setw(7) << stats.count << fixed << setprecision(2)
+                 << setw(14) << stats.totalSalary << setw(12) << stats.meanSalary()
+                 << setw(12) << stats.minSalary << setw(12) << stats.maxSalary << endl;
+        }
+        cout << "============================================================\n";
     }
 
     void displayAllEmployees() {
+        ensureEmployeesLoaded();
         if (employees.empty()) {
             cout << "\nNo employees found.\n";
             return;
@@ -163,10 +537,23 @@ public:
             return;
         }
 
-        Project proj(nextProjectId, title, description, emp->getName(),
-                    empId, deadline, projectType);
+        ensureProjectsLoaded();
+        BlobRef descriptionRef;
+        if (!projectBlobs.put(description, descriptionRef)) {
+            cout << "Error: Cannot write to " << PROJECT_BLOB_FILE << "; project not assigned!\n";
+            return;
+        }
+        Project proj(nextProjectId, title, descriptionRef, emp->getName(),
+                    empId, deadline, projectType, &projectBlobs);
+        projectRowById.emplace(proj.getProjectId(), projects.size());
+        projectRowsByEmployee[empId].push_back(projects.size());
         projects.push_back(proj);
+        projectIndex.addDocument(proj.getProjectId(), projectSearchText(proj));
         emp->addProjectId(nextProjectId);
+        stageEmployeeVersion(*emp);
+        commitEmployeeVersion();
+        projectsDirty = true;
+        employeesDirty = true;
 
         saveProjects();
         saveEmployees();
@@ -175,29 +562,91 @@ public:
         nextProjectId++;
     }
 
-    Project* findProjectById(int pid) {
-        for (size_t i = 0; i < projects.size(); i++) {
-            if (projects[i].getProjectId() == pid) {
-                return &projects[i];
+    // Gives every listed employee their own copy of one project. All records
+    // and assignedProjectIds are updated in memory first and each file is
+    // written once at the end, instead of twice per employee. Unknown and
+    // repeated IDs are skipped. Returns the number of projects created.
+    size_t assignProjectBulk(vector<int> empIds, string title, string description,
+                             string deadline, string projectType) {
+        ensureEmployeesLoaded();
+        ensureProjectsLoaded();
+
+        size_t requested = empIds.size();
+        sort(empIds.begin(), empIds.end());
+        empIds.erase(unique(empIds.begin(), empIds.end()), empIds.end());
+        size_t duplicates = requested - empIds.size();
+
+        BlobRef sharedDescription; // one copy for every project
+        if (!projectBlobs.put(description, sharedDescription)) {
+            cout << "Error: Cannot write to " << PROJECT_BLOB_FILE << "; no projects assigned!\n";
+            return 0;
+        }
+        // Every copy shares title and description and starts without feedback,
+        // so the indexed text is the same; build it from memory, not the blob
+        const string searchText = title + " " + description + " ";
+        int firstId = nextProjectId;
+        size_t unknown = 0;
+        projects.reserve(projects.size() + empIds.size());
+        for (int empId : empIds) {
+            auto it = employeeRowById.find(empId);
+            if (it == employeeRowById.end()) {
+                unknown++;
+                continue;
             }
+            Employee& emp = employees[it->second];
+            Project proj(nextProjectId, title, sharedDescription, emp.getName(),
+                         empId, deadline, projectType, &projectBlobs);
+            projectRowById.emplace(proj.getProjectId(), projects.size());
+            projectRowsByEmployee[empId].push_back(projects.size());
+            projects.push_back(proj);
+            projectIndex.addDocument(proj.getProjectId(), searchText);
+            emp.addProjectId(nextProjectId);
+            stageEmployeeVersion(emp);
+            nextProjectId++;
         }
-        return nullptr;
+        commitEmployeeVersion();
+
+        size_t created = (size_t)(nextProjectId - firstId);
+        if (created == 0) {
+            cout << "\nNo employees to assign.\n";
+            return 0;
+        }
+        projectsDirty = true;
+        employeesDirty = true;
+        saveProjects();
+        saveEmployees();
+
+        cout << "\n" << created << " project(s) assigned (IDs " << firstId << "-"
+             << nextProjectId - 1 << ").\n";
+        if (unknown > 0) cout << unknown << " unknown employee ID(s) skipped.\n";
+        if (duplicates > 0) cout << duplicates << " repeated ID(s) ignored.\n";
+        return created;
+    }
+
+    Project* findProjectById(int pid) {
+        ensureProjectsLoaded();
+        auto it = projectRowById.find(pid);
+        return it == projectRowById.end() ? nullptr : &projects[it->second];
     }
 
     vector<Project> getEmployeeProjects(int empId) {
+        ensureProjectsLoaded();
         vector<Project> empProjects;
-        for (const auto& proj : projects) {
-            if (proj.getEmployeeId() == empId) {
-                empProjects.push_back(proj);
-            }
+        auto it = projectRowsByEmployee.find(empId);
+        if (it == projectRowsByEmployee.end()) return empProjects;
+        empProjects.reserve(it->second.size());
+        for (size_t row : it->second) {
+            empProjects.push_back(projects[row]);
         }
         return empProjects;
     }
 
     vector<Project> getSubmittedProjects() {
+        ensureProjectsLoaded();
         vector<Project> submitted;
+        static const Symbol SUBMITTED("Submitted");
         for (const auto& proj : projects) {
-            if (proj.getStatus() == "Submitted") {
+            if (proj.getStatusSymbol() == SUBMITTED) {
                 submitted.push_back(proj);
             }
         }
@@ -205,9 +654,11 @@ public:
     }
 
     vector<Project> getCompletedProjects() {
+        ensureProjectsLoaded();
         vector<Project> completed;
+        static const Symbol COMPLETED("Completed");
         for (const auto& proj : projects) {
-            if (proj.getStatus() == "Completed") {
+            if (proj.getStatusSymbol() == COMPLETED) {
                 completed.push_back(proj);
             }
         }
@@ -221,9 +672,13 @@ public:
             return;
         }
 
-        proj->setSubmissionContent(content);
+        if (!proj->setSubmissionContent(content)) {
+            cout << "Error: Cannot write to " << PROJECT_BLOB_FILE << "; submission not saved!\n";
+            return;
+        }
         proj->setSubmissionDate(getCurrentDateTime());
         proj->setStatus("Submitted");
+        projectsDirty = true;
         saveProjects();
         cout << "\nProject submitted successfully!\n";
     }
@@ -235,8 +690,13 @@ public:
             return;
         }
 
-        proj->setFeedback(feedback);
+        if (!proj->setFeedback(feedback)) {
+            cout << "Error: Cannot write to " << PROJECT_BLOB_FILE << "; feedback not saved!\n";
+            return;
+        }
         proj->setStatus("Feedback");
+        projectIndex.addDocument(projectId, projectSearchText(*proj));
+        projectsDirty = true;
         saveProjects();
         cout << "\nFeedback sent to employee!\n";
     }
@@ -249,11 +709,13 @@ public:
         }
 
         proj->setStatus("Completed");
+        projectsDirty = true;
         saveProjects();
         cout << "\nProject accepted and marked as completed!\n";
     }
 
     void displayAllProjects() {
+        ensureProjectsLoaded();
         if (projects.empty()) {
             cout << "\nNo projects found.\n";
             return;
@@ -289,60 +751,251 @@ public:
             return;
         }
 
+        string subject = "Project Submission - " + proj->getTitle();
+        string body = "Project ID: " + to_string(proj->getProjectId()) + "\n" +
+                      "Title: " + proj->getTitle() + "\n" +
+                      "Status: " + proj->getStatus() + "\n" +
+                      "Submitted by: " + proj->getAssignedTo() + "\n";
+        int messageId = queueEmail(recipientEmail, subject, body);
+        if (messageId == 0) {
+            cout << "Error: Mail queue is not running!\n";
+            return;
+        }
+
         cout << "\n========================================\n";
-        cout << "     EMAIL SENT SUCCESSFULLY!\n";
+        cout << "     EMAIL QUEUED FOR DELIVERY\n";
         cout << "========================================\n";
         cout << "To: " << recipientEmail << endl;
-        cout << "Subject: Project Submission - " << proj->getTitle() << endl;
-        cout << "Project ID: " << proj->getProjectId() << endl;
-        cout << "Status: " << proj->getStatus() << endl;
-        cout << "Submitted by: " << proj->getAssignedTo() << endl;
+        cout << "Subject: " << subject << endl;
+        cout << "Message #" << messageId << ", " << mailQueue.getStats().depth << " in queue\n";
+        cout << "========================================\n";
+    }
+
+    // Mail
+    void ensureMailQueueStarted() {
+        mailQueue.start(MAIL_QUEUE_FILE, MAIL_FAILED_FILE, MAIL_CONFIG_FILE);
+    }
+
+    // Hands the message to the background sender; returns its queue ID, or
+    // 0 if it was not queued.
+    int queueEmail(string to, string subject, string body) {
+        if (!isValidEmail(to)) return 0;
+        ensureMailQueueStarted();
+        return mailQueue.enqueue(to, subject, body);
+    }
+
+    bool flushMailQueue(int maxSeconds) {
+        ensureMailQueueStarted();
+        return mailQueue.waitUntilEmpty(maxSeconds);
+    }
+
+    void displayMailQueueStatus() {
+        ensureMailQueueStarted();
+        MailRelayConfig config = mailQueue.getConfig();
+        MailQueueStats stats = mailQueue.getStats();
+        cout << "\n========================================\n";
+        cout << "           MAIL QUEUE STATUS\n";
+        cout << "========================================\n";
+        cout << "Relay: " << config.host << ":" << config.port << " (from " << config.from
+             << ", " << config.batchSize << " per batch)\n";
+        cout << "Queue depth: " << stats.depth << " (" << stats.inFlight << " sending)\n";
+        cout << "This session: " << stats.enqueued << " queued, " << stats.sent << " sent, "
+             << stats.failed << " failed, " << stats.retries << " retries scheduled\n";
+        cout << "Batches: " << stats.batches;
+        if (stats.sendSeconds > 0) {
+            cout << ", " << fixed << setprecision(1) << stats.sent / stats.sendSeconds
+                 << " msgs/sec while sending";
+        }
+        cout << endl;
+        if (!stats.lastError.empty()) cout << "Last error: " << stats.lastError << endl;
         cout << "========================================\n";
     }
 
     // Attendance Management
     void markAttendance(int empId, bool present, int overtimeHours) {
+        if (!AttendanceStore::isValidOvertime(overtimeHours)) {
+            cout << "Invalid overtime hours! Use 0-" << AttendanceStore::MAX_OVERTIME << ".\n";
+            return;
+        }
+        ensureEmployeesLoaded();
+        if (empId <= 0 || !employeeIdSet.contains((uint32_t)empId)) {
+            cout << "Employee not found!\n";
+            return;
+        }
+        ensureAttendanceLoaded();
+        size_t firstRow = attendanceStore.size();
         Attendance att(empId, getCurrentDate(), present, overtimeHours);
-        attendanceRecords.push_back(att);
-        saveAttendance();
+        if (attendanceStore.append(att)) {
+            size_t row = attendanceStore.size() - 1;
+            attendanceCalendar.mark(empId, attendanceStore.getDay(row), present,
+                                    attendanceStore.getOvertimeHours(row));
+        }
+        commitAttendanceVersion(firstRow);
+        appendAttendanceToFile(firstRow);
         cout << "\nAttendance marked successfully!\n";
     }
 
-    double calculateAttendancePercentage(int empId) {
-        int totalDays = 0;
-        int presentDays = 0;
+    vector<int> getAllEmployeeIds() {
+        ensureEmployeesLoaded();
+        vector<int> ids;
+        ids.reserve(employees.size());
+        for (const auto& emp : employees) ids.push_back(emp.getId());
+        return ids;
+    }
+
+    vector<int> getDepartmentEmployeeIds(string dept) {
+        ensureEmployeesLoaded();
+        const set<int>& members = departmentIndex.getMembers(dept);
+        return vector<int>(members.begin(), members.end());
+    }
+
+    vector<int> getPositionEmployeeIds(string position) {
+        ensureEmployeesLoaded();
+        const set<int>& members = positionIndex.getMembers(position);
+        return vector<int>(members.begin(), members.end());
+    }
 
-        for (const auto& att : attendanceRecords) {
-            if (att.getEmployeeId() == empId) {
-                totalDays++;
-                if (att.isPresent()) presentDays++;
+    // Roll call: marks every listed employee present/absent on one date (blank
+    // = today) with the given overtime, or their entry in overtimeOverrides.
+    // Rows go into the store in one batch, the calendar is sized once, and
+    // only the new rows are appended to attendance.dat. Unknown and repeated
+    // IDs are skipped. Returns the number of employees marked.
+    size_t markAttendanceBulk(vector<int> empIds, string date, bool present, int overtimeHours,
+                              const unordered_map<int, int>& overtimeOverrides) {
+        if (date.empty()) date = getCurrentDate();
+        int dayNumber;
+        if (!DateUtils::parseDate(date, dayNumber)) {
+            cout << "Invalid date! Use YYYY-MM-DD.\n";
+            return 0;
+        }
+        if (!AttendanceStore::isValidOvertime(overtimeHours)) {
+            cout << "Invalid overtime hours! Use 0-" << AttendanceStore::MAX_OVERTIME << ".\n";
+            return 0;
+        }
+        for (const auto& over : overtimeOverrides) {
+            if (!AttendanceStore::isValidOvertime(over.second)) {
+                cout << "Invalid overtime hours for employee " << over.first << "! Use 0-"
+                     << AttendanceStore::MAX_OVERTIME << ".\n";
+                return 0;
             }
         }
+        ensureEmployeesLoaded();
+        ensureAttendanceLoaded();
+
+        size_t requested = empIds.size();
+        sort(empIds.begin(), empIds.end());
+        empIds.erase(unique(empIds.begin(), empIds.end()), empIds.end());
+        size_t duplicates = requested - empIds.size();
+        size_t unknown = 0;
+        size_t kept = 0;
+        for (int id : empIds) {
+            if (id > 0 && employeeIdSet.contains((uint32_t)id)) empIds[kept++] = id;
+            else unknown++;
+        }
+        empIds.resize(kept);
+        if (empIds.empty()) {
+            cout << "\nNo employees to mark.\n";
+            return 0;
+        }
+
+        size_t firstRow = attendanceStore.size();
+        attendanceStore.reserveForAppend(empIds.size());
+        attendanceCalendar.reserveIds(empIds);
+        for (int id : empIds) {
+            auto over = overtimeOverrides.find(id);
+            int hours = over == overtimeOverrides.end() ? overtimeHours : over->second;
+            attendanceStore.append(id, dayNumber, present, hours);
+            size_t row = attendanceStore.size() - 1;
+            attendanceCalendar.mark(id, dayNumber, present, attendanceStore.getOvertimeHours(row));
+        }
+        commitAttendanceVersion(firstRow);
+        appendAttendanceToFile(firstRow);
+
+        cout << "\nAttendance marked " << (present ? "present" : "absent") << " for "
+             << empIds.size() << " employee(s) on " << date << ".\n";
+        if (unknown > 0) cout << unknown << " unknown employee ID(s) skipped.\n";
+        if (duplicates > 0) cout << duplicates << " repeated ID(s) ignored.\n";
+        return empIds.size();
+    }
+
+    static double attendancePercentage(const AttendanceTally& tally) {
+        if (tally.totalDays == 0) return 0.0;
+        return (double)tally.presentDays / tally.totalDays * 100.0;
+    }
+
+    // Percentage of marked days the employee was present, from the yearly
+    // bitmaps (a popcount per year, independent of the size of the log).
+    double calculateAttendancePercentage(int empId) {
+        ensureAttendanceLoaded();
+        return attendancePercentage(attendanceCalendar.tally(empId));
+    }
 
-        if (totalDays == 0) return 0.0;
-        return (double)presentDays / totalDays * 100.0;
+    // Same, restricted to [fromDate, toDate] (YYYY-MM-DD, inclusive)
+    double calculateAttendancePercentage(int empId, string fromDate, string toDate) {
+        ensureAttendanceLoaded();
+        int from, to;
+        if (!DateUtils::parseDate(fromDate, from) || !DateUtils::parseDate(toDate, to)) return 0.0;
+        return attendancePercentage(attendanceCalendar.tallyWindow(empId, from, to));
     }
 
     int getTotalOvertimeHours(int empId) {
-        int total = 0;
-        for (const auto& att : attendanceRecords) {
-            if (att.getEmployeeId() == empId) {
-                total += att.getOvertimeHours();
-            }
+        ensureAttendanceLoaded();
+        return attendanceCalendar.tally(empId).overtimeHours;
+    }
+
+    // Attendance totals for every employee, aligned with the employees vector.
+    vector<AttendanceTally> tallyAllEmployees() {
+        ensureEmployeesLoaded();
+        ensureAttendanceLoaded();
+        vector<AttendanceTally> tallies;
+        tallies.reserve(employees.size());
+        for (const auto& emp : employees) tallies.push_back(attendanceCalendar.tally(emp.getId()));
+        return tallies;
+    }
+
+    void displayAttendanceForRange(int empId, string fromDate, string toDate) {
+        ensureAttendanceLoaded();
+        int from, to;
+        if (!DateUtils::parseDate(fromDate, from) || !DateUtils::parseDate(toDate, to) || from > to) {
+            cout << "Invalid date range! Use YYYY-MM-DD.\n";
+            return;
         }
-        return total;
+        AttendanceTally t = attendanceCalendar.tallyWindow(empId, from, to);
+        cout << "\n========================================\n";
+        cout << "   ATTENDANCE " << fromDate << " to " << toDate << "\n";
+        cout << "========================================\n";
+        cout << "Employee ID: " << empId << endl;
+        cout << "Days Recorded: " << t.totalDays << endl;
+        cout << "Days Present: " << t.presentDays << endl;
+        cout << "Attendance: " << fixed << setprecision(2) << attendancePercentage(t) << "%\n";
+        cout << "========================================\n";
     }
 
     // Performance Management
     void calculateAndUpdatePerformance(int empId) {
-        double attPercentage = calculateAttendancePercentage(empId);
-        int overtimeHours = getTotalOvertimeHours(empId);
+        refreshPerformance(empId);
+        savePerformance();
+    }
+
+    // Recomputes an employee's performance in memory only; callers that
+    // refresh many employees save once at the end instead of per employee.
+    void refreshPerformance(int empId) {
+        ensureAttendanceLoaded();
+        refreshPerformance(empId, attendanceCalendar.tally(empId));
+    }
+
+    void refreshPerformance(int empId, const AttendanceTally& attendance) {
+        ensureProjectsLoaded();
+        ensurePerformanceLoaded();
+        double attPercentage = attendancePercentage(attendance);
+        int overtimeHours = attendance.overtimeHours;
 
         int completedProjects = 0;
         int onTimeSubmissions = 0;
 
+        static const Symbol COMPLETED("Completed");
         for (const auto& proj : projects) {
-            if (proj.getEmployeeId() == empId && proj.getStatus() == "Completed") {
+            if (proj.getEmployeeId() == empId && proj.getStatusSymbol() == COMPLETED) {
                 completedProjects++;
                 if (proj.getSubmissionDate() <= proj.getDeadline()) {
                     onTimeSubmissions++;
@@ -353,10 +1006,12 @@ public:
         Performance perf(empId, attPercentage, overtimeHours,
                         completedProjects, onTimeSubmissions);
         performanceMap[empId] = perf;
-        savePerformance();
+        leaderboard.update(empId, perf.getPerformanceScore());
+        performanceDirty = true;
     }
 
     Performance* getEmployeePerformance(int empId) {
+        ensurePerformanceLoaded();
         if (performanceMap.find(empId) != performanceMap.end()) {
             return &performanceMap[empId];
         }
@@ -368,38 +1023,81 @@ public:
         cout << "         PERFORMANCE SCOREBOARD\n";
         cout << "==============================================\n";
 
-        for (auto& emp : employees) {
-            calculateAndUpdatePerformance(emp.getId());
+        vector<AttendanceTally> tallies = tallyAllEmployees();
+        for (size_t i = 0; i < employees.size(); i++) {
+            refreshPerformance(employees[i].getId(), tallies[i]);
         }
+        savePerformance();
+
+        printRankingRows(leaderboard.top(leaderboard.size()), 1);
+        cout << "==============================================\n";
+    }
+
+    // Ranking Queries (served by the leaderboard, no sorting)
+    size_t getEmployeeRank(int empId) {
+        ensurePerformanceLoaded();
+        return leaderboard.rankOf(empId);
+    }
+
+    size_t getRankedCount() {
+        ensurePerformanceLoaded();
+        return leaderboard.size();
+    }
 
-        vector<pair<int, Performance>> perfList;
-        for (const auto& entry : performanceMap) {
-            perfList.push_back(entry);
+    // Ranks fromRank..toRank (1-based, inclusive)
+    void displayRankings(size_t fromRank, size_t toRank) {
+        ensurePerformanceLoaded();
+        ensureEmployeesLoaded();
+        cout << "\n==============================================\n";
+        cout << "      PERFORMANCE RANKS " << fromRank << " - " << toRank << "\n";
+        cout << "==============================================\n";
+        if (fromRank < 1 || fromRank > toRank || fromRank > leaderboard.size()) {
+            cout << "No employees in that rank range (" << leaderboard.size() << " ranked).\n";
+        } else {
+            printRankingRows(leaderboard.range(fromRank, toRank), fromRank);
         }
+        cout << "==============================================\n";
+    }
 
-        sort(perfList.begin(), perfList.end(),
-             [](const pair<int, Performance>& a, const pair<int, Performance>& b) {
-                 return a.second.getPerformanceScore() > b.second.getPerformanceScore();
-             });
+    void displayEmployeeRank(int empId) {
+        ensurePerformanceLoaded();
+        size_t rank = leaderboard.rankOf(empId);
+        cout << "\n========================================\n";
+        cout << "           PERFORMANCE RANK\n";
+        cout << "========================================\n";
+        if (rank == 0) {
+            cout << "No performance data available yet.\n";
+        } else {
+            const Performance& perf = performanceMap[empId];
+            cout << "Employee ID: " << empId << endl;
+            cout << "Rank: " << rank << " of " << leaderboard.size() << endl;
+            cout << "Score: " << fixed << setprecision(2) << perf.getPerformanceScore() << "/100\n";
+            cout << "Grade: " << perf.getPerformanceGrade() << endl;
+        }
+        cout << "========================================\n";
+    }
 
+    void printRankingRows(const vector<pair<int, double>>& rows, size_t firstRank) {
         cout << left << setw(6) << "Rank" << setw(8) << "Emp ID"
              << setw(20) << "Name" << setw(10) << "Score"
              << setw(8) << "Grade" << endl;
         cout << "----------------------------------------------\n";
 
-        int rank = 1;
-        for (const auto& entry : perfList) {
-            Employee* emp = findEmployeeById(entry.first);
-            if (emp) {
-                cout << left << setw(6) << rank++
-                     << setw(8) << emp->getId()
-                     << setw(20) << emp->getName()
-                     << setw(10) << fixed << setprecision(2)
-                     << entry.second.getPerformanceScore()
-                     << setw(8) << entry.second.getPerformanceGrade() << endl;
+        // Names come from the ID -> row map, one hash lookup per row
+        ensureEmployeesLoaded();
+        size_t rank = firstRank;
+        for (const auto& row : rows) {
+            auto it = employeeRowById.find(row.first);
+            if (it != employeeRowById.end()) {
+                const Employee& emp = employees[it->second];
+                cout << left << setw(6) << rank
+                     << setw(8) << emp.getId()
+                     << setw(20) << emp.getName()
+                     << setw(10) << fixed << setprecision(2) << row.second
+                     << setw(8) << performanceMap[row.first].getPerformanceGrade() << endl;
             }
+            rank++;
         }
-        cout << "==============================================\n";
     }
 
     void yearEndEvaluation() {
@@ -407,144 +1105,989 @@ public:
         cout << "     YEAR-END EVALUATION REPORT\n";
         cout << "========================================\n";
 
-        for (auto& emp : employees) {
-            calculateAndUpdatePerformance(emp.getId());
-            Performance* perf = getEmployeePerformance(emp.getId());
+        vector<AttendanceTally> tallies = tallyAllEmployees();
+        size_t n = employees.size();
 
+        // Pass 1: refresh every score and pick its raise band
+        vector<int> bands(n, -1);
+        vector<double> rates(n, 0.0);
+        for (size_t i = 0; i < n; i++) {
+            refreshPerformance(employees[i].getId(), tallies[i]);
+            Performance* perf = getEmployeePerformance(employees[i].getId());
             if (!perf) continue;
+            bands[i] = RaiseBands::bandForScore(perf->getPerformanceScore());
+            rates[i] = RaiseBands::rateForBand(bands[i]);
+        }
+
+        // Pass 2: apply all raises at once over the salary column
+        vector<double> oldSalaries(salaryColumn.salaryData(), salaryColumn.salaryData() + n);
+        PayrollKernels::applyRaises(salaryColumn.salaryData(), rates.data(), n);
+
+        // Pass 3: write the new salaries back and report
+        for (size_t i = 0; i < n; i++) {
+            if (bands[i] < 0) continue;
+            Employee& emp = employees[i];
+            Performance* perf = getEmployeePerformance(emp.getId());
 
             cout << "\n--- Employee: " << emp.getName() << " (ID: " << emp.getId() << ") ---\n";
             cout << "Current Position: " << emp.getPosition() << endl;
-            cout << "Current Salary: $" << fixed << setprecision(2) << emp.getSalary() << endl;
+            cout << "Current Salary: $" << fixed << setprecision(2) << oldSalaries[i] << endl;
             cout << "Performance Score: " << perf->getPerformanceScore() << " (Grade: "
                  << perf->getPerformanceGrade() << ")\n";
 
-            double salaryIncrease = 0;
-            string action = "";
-
-            if (perf->getPerformanceScore() >= 90) {
-                salaryIncrease = emp.getSalary() * 0.20;
-                action = "PROMOTION + 20% Salary Increase";
-            } else if (perf->getPerformanceScore() >= 85) {
-                salaryIncrease = emp.getSalary() * 0.15;
-                action = "15% Salary Increase";
-            } else if (perf->getPerformanceScore() >= 75) {
-                salaryIncrease = emp.getSalary() * 0.10;
-                action = "10% Salary Increase";
-            } else if (perf->getPerformanceScore() >= 65) {
-                salaryIncrease = emp.getSalary() * 0.05;
-                action = "5% Salary Increase";
-            } else if (perf->getPerformanceScore() >= 50) {
-                action = "No Salary Change";
-            } else {
-                salaryIncrease = -(emp.getSalary() * 0.10);
-                action = "DEMOTION - 10% Salary Decrease";
-            }
+            emp.setSalary(salaryColumn.getSalary(i));
+            departmentIndex.updateSalary(emp.getDepartment(), emp.getId(), oldSalaries[i], emp.getSalary());
+            positionIndex.updateSalary(emp.getPosition(), emp.getId(), oldSalaries[i], emp.getSalary());
+            stageEmployeeVersion(emp);
+            employeesDirty = true;
 
-            emp += salaryIncrease;
-
-            cout << "Action: " << action << endl;
+            cout << "Action: " << RaiseBands::actionForBand(bands[i]) << endl;
             cout << "New Salary: $" << fixed << setprecision(2) << emp.getSalary() << endl;
             cout << "----------------------------------------\n";
         }
 
+        commitEmployeeVersion();
         saveEmployees();
+        savePerformance();
         cout << "\nYear-end evaluation completed and saved!\n";
     }
 
-    // Notice Management
-    void postNotice(string title, string content, string type) {
-        Notice notice(nextNoticeId++, title, content, getCurrentDate(), type);
-        notices.push_back(notice);
-        saveNotices();
-        cout << "\nNotice posted successfully!\n";
+    // Snapshots
+    // Employees as of the last commit; writers carry on while it is held.
+    EmployeeVersions::Snapshot pinEmployees() {
+        ensureEmployeeVersionsBuilt();
+        return employeeVersions.snapshot();
     }
 
-    void displayAllNotices() {
-        if (notices.empty()) {
-            cout << "\nNo notices available.\n";
-            return;
-        }
+    AttendanceVersions::Snapshot pinAttendance() {
+        ensureAttendanceVersionsBuilt();
+        return attendanceVersions.snapshot();
+    }
 
-        cout << "\n========================================\n";
-        cout << "           NOTICE BOARD\n";
-        cout << "========================================\n";
-        for (const auto& notice : notices) {
-            notice.display();
-        }
+    void ensureEmployeeVersionsBuilt() {
+        ensureEmployeesLoaded();
+        if (!employeeVersionsBuilt) rebuildEmployeeVersions();
     }
 
-    vector<Notice> getNoticesByType(string type) {
-        vector<Notice> filtered;
-        for (const auto& notice : notices) {
-            if (notice.getType() == type) {
-                filtered.push_back(notice);
-            }
-        }
-        return filtered;
+    void ensureAttendanceVersionsBuilt() {
+        ensureAttendanceLoaded();
+        if (!attendanceVersionsBuilt) rebuildAttendanceVersions();
     }
 
-    // Recruitment Management
-    void addCandidate(string name, string email, string phone, string position) {
-        if (!isValidName(name) || !isValidEmail(email) || !isValidPhone(phone)) {
-            cout << "Invalid candidate details!\n";
-            return;
-        }
+    // Writers stage changed rows, then commit them as one new version
+    void stageEmployeeVersion(const Employee& emp) {
+        if (!employeeVersionsBuilt) return;
+        employeeVersions.put((size_t)(&emp - employees.data()), EmployeeSnapshotRow(emp));
+    }
 
-        Candidate candidate(nextCandidateId++, name, email, phone,
-                          position, getCurrentDate());
-        candidates.push_back(candidate);
-        saveCandidates();
-        cout << "\nCandidate added successfully! ID: " << candidate.getCandidateId() << endl;
+    void commitEmployeeVersion() {
+        if (employeeVersionsBuilt) employeeVersions.commit();
     }
 
-    Candidate* findCandidateById(int cid) {
-        for (size_t i = 0; i < candidates.size(); i++) {
-            if (candidates[i].getCandidateId() == cid) {
-                return &candidates[i];
-            }
+    // Publishes store rows from firstRow on (the log is append-only)
+    void commitAttendanceVersion(size_t firstRow) {
+        if (!attendanceVersionsBuilt) return;
+        for (size_t i = firstRow; i < attendanceStore.size(); i++) {
+            attendanceVersions.append(attendanceSnapshotRow(i));
         }
-        return nullptr;
+        attendanceVersions.commit();
     }
 
-    void updateCandidateStatus(int candidateId, string newStatus, string interviewDate = "") {
-        Candidate* candidate = findCandidateById(candidateId);
-        if (!candidate) {
-            cout << "Candidate not found!\n";
-            return;
-        }
+    AttendanceSnapshotRow attendanceSnapshotRow(size_t row) const {
+        return AttendanceSnapshotRow{attendanceStore.getEmployeeId(row), attendanceStore.getDay(row),
+                                     attendanceStore.isPresent(row),
+                                     (uint8_t)attendanceStore.getOvertimeHours(row)};
+    }
 
-        candidate->setStatus(newStatus);
-        if (interviewDate != "") {
-            candidate->setInterviewDate(interviewDate);
-        }
-        saveCandidates();
-        cout << "\nCandidate status updated!\n";
+    void rebuildEmployeeVersions() {
+        employeeVersions.clear();
+        for (const auto& emp : employees) employeeVersions.append(EmployeeSnapshotRow(emp));
+        employeeVersions.commit();
+        employeeVersionsBuilt = true;
     }
 
-    void displayAllCandidates() {
-        if (candidates.empty()) {
-            cout << "\nNo candidates found.\n";
-            return;
-        }
+    void rebuildAttendanceVersions() {
+        attendanceVersions.clear();
+        for (size_t i = 0; i < attendanceStore.size(); i++) attendanceVersions.append(attendanceSnapshotRow(i));
+        attendanceVersions.commit();
+        attendanceVersionsBuilt = true;
+    }
 
+    void displaySnapshotStatus() {
+        snapshotEpochs.reclaim();
         cout << "\n========================================\n";
-        cout << "          CANDIDATE LIST\n";
+        cout << "           SNAPSHOT STATUS\n";
+        cout << "========================================\n";
+        cout << "Employees:  " << (employeeVersionsBuilt ? "version " + to_string(employeeVersions.versionNumber()) +
+                                   ", " + to_string(employeeVersions.size()) + " rows" : "not built yet") << endl;
+        cout << "Attendance: " << (attendanceVersionsBuilt ? "version " + to_string(attendanceVersions.versionNumber()) +
+                                   ", " + to_string(attendanceVersions.size()) + " rows" : "not built yet") << endl;
+        cout << "Pinned readers: " << snapshotEpochs.pinnedCount() << endl;
+        cout << "Retired, awaiting readers: " << snapshotEpochs.pendingCount() << endl;
+        cout << "Reclaimed: " << snapshotEpochs.reclaimedCount() << endl;
         cout << "========================================\n";
-        for (const auto& candidate : candidates) {
-            candidate.display();
-        }
     }
 
-    vector<Candidate> getCandidatesByStatus(string status) {
-        vector<Candidate> filtered;
-        for (const auto& candidate : candidates) {
-            if (candidate.getStatus() == status) {
-                filtered.push_back(candidate);
-            }
+    // Exports
+    // Streams one report to path as CSV or JSON Lines. report is employees,
+    // projects, attendance, performance or year-end; the date range filters
+    // joining date, deadline and attendance day respectively.
+    bool exportReport(string report, string format, string path, const ExportFilter& filter) {
+        ExportFormat fmt;
+        if (format == "csv") fmt = ExportFormat::CSV;
+        else if (format == "jsonl" || format == "json") fmt = ExportFormat::JSONL;
+        else {
+            cout << "Error: Format must be csv or jsonl!\n";
+            return false;
         }
-        return filtered;
-    }
+        bool dated = report == "employees" || report == "projects" || report == "attendance";
+        if (!dated && report != "performance" && report != "year-end") {
+            cout << "Error: Unknown report '" << report
+                 << "' (employees, projects, attendance, performance, year-end)!\n";
+            return false;
+        }
+        if (!dated && filter.hasDateRange()) {
+            cout << "Note: The " << report << " report has no date column; date range ignored.\n";
+        }
+
+        // Load before timing so the figure is export throughput only
+        ensureEmployeesLoaded();
+        if (report == "projects") ensureProjectsLoaded();
+        else if (report == "attendance") ensureAttendanceVersionsBuilt();
+        else ensureEmployeeVersionsBuilt();
+        if (!dated) ensurePerformanceLoaded();
+
+        ExportWriter writer;
+        if (!writer.open(path)) {
+            cout << "Error: Cannot open " << path << " for writing!\n";
+            return false;
+        }
+        auto began = chrono::steady_clock::now();
+        size_t rows = 0;
+        if (report == "employees") rows = exportEmployees(writer, fmt, filter);
+        else if (report == "projects") rows = exportProjects(writer, fmt, filter);
+        else if (report == "attendance") rows = exportAttendance(writer, fmt, filter);
+        else if (report == "performance") rows = exportPerformance(writer, fmt, filter);
+        else rows = exportYearEndOutcomes(writer, fmt, filter);
+        writer.close();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - began).count();
+
+        if (!writer.good()) {
+            cout << "Error: Writing " << path << " failed (disk full?)!\n";
+            return false;
+        }
+        double mb = writer.bytesWritten() / (1024.0 * 1024.0);
+        cout << "Exported " << rows << " row(s), " << fixed << setprecision(2) << mb << " MB to "
+             << path << " in " << setprecision(1) << seconds * 1000 << " ms";
+        if (seconds > 0 && mb >= 1) cout << " (" << setprecision(0) << mb / seconds << " MB/s)";
+        cout << endl;
+        return true;
+    }
+
+    // Employee-side reports read a pinned snapshot, so a long export sees
+    // one consistent state while writers keep committing.
+    size_t exportEmployees(ExportWriter& writer, ExportFormat fmt, const ExportFilter& filter) {
+        ExportTable table(writer, fmt, {"id", "name", "email", "phone", "department", "position",
+                                        "salary", "joiningDate", "projectCount"});
+        Symbol dept;
+        if (!filter.department.empty() && !Symbol::find(filter.department, dept)) {
+            return table.rowCount(); // no record holds that department
+        }
+        auto view = pinEmployees();
+        view.forEach([&](const EmployeeSnapshotRow& emp) {
+            if ((!dept.empty() && emp.department != dept) || !filter.includesDate(emp.joiningDate)) return;
+            table.integer(emp.id);
+            table.text(emp.name);
+            table.text(emp.email);
+            table.text(emp.phone);
+            table.text(emp.department.str());
+            table.text(emp.position.str());
+            table.decimal(emp.salary);
+            table.text(emp.joiningDate);
+            table.integer(emp.projectCount);
+            table.endRow();
+        });
+        return table.rowCount();
+    }
+
+    size_t exportProjects(ExportWriter& writer, ExportFormat fmt, const ExportFilter& filter) {
+        ExportTable table(writer, fmt, {"projectId", "title", "employeeId", "assignedTo", "department",
+                                        "status", "type", "deadline", "submissionDate"});
+        Symbol dept;
+        if (!filter.department.empty() && !Symbol::find(filter.department, dept)) {
+            return table.rowCount(); // no record holds that department
+        }
+        for (const auto& proj : projects) {
+            if (!filter.includesDate(proj.getDeadline())) continue;
+            auto row = employeeRowById.find(proj.getEmployeeId());
+            const Employee* emp = row == employeeRowById.end() ? nullptr : &employees[row->second];
+            if (!dept.empty() && (!emp || emp->getDepartmentSymbol() != dept)) continue;
+            table.integer(proj.getProjectId());
+            table.text(proj.getTitle());
+            table.integer(proj.getEmployeeId());
+            table.text(proj.getAssignedTo());
+            table.text(emp ? emp->getDepartment() : "");
+            table.text(proj.getStatus());
+            table.text(proj.getProjectType());
+            table.text(proj.getDeadline());
+            table.text(proj.getSubmissionDate());
+            table.endRow();
+        }
+        return table.rowCount();
+    }
+
+    // The department filter becomes an ID bitmap so each row costs one
+    // membership test.
+    size_t exportAttendance(ExportWriter& writer, ExportFormat fmt, const ExportFilter& filter) {
+        RoaringBitmap members;
+        bool byDepartment = !filter.department.empty();
+        if (byDepartment) {
+            for (int id : departmentIndex.getMembers(filter.department)) members.add((uint32_t)id);
+        }
+        ExportTable table(writer, fmt, {"employeeId", "date", "present", "overtimeHours"});
+        auto view = pinAttendance();
+        view.forEach([&](const AttendanceSnapshotRow& att) {
+            if (!filter.includesDay(att.day) ||
+                (byDepartment && !members.contains((uint32_t)att.employeeId))) return;
+            table.integer(att.employeeId);
+            table.date(att.day);
+            table.boolean(att.present);
+            table.integer(att.overtimeHours);
+            table.endRow();
+        });
+        return table.rowCount();
+    }
+
+    // Latest computed scores (as shown on the scoreboard), in employee order
+    size_t exportPerformance(ExportWriter& writer, ExportFormat fmt, const ExportFilter& filter) {
+        ExportTable table(writer, fmt, {"employeeId", "name", "department", "attendancePercentage",
+                                        "overtimeHours", "projectsCompleted", "onTimeSubmissions",
+                                        "score", "grade", "rank"});
+        Symbol dept;
+        if (!filter.department.empty() && !Symbol::find(filter.department, dept)) {
+            return table.rowCount(); // no record holds that department
+        }
+        auto view = pinEmployees();
+        view.forEach([&](const EmployeeSnapshotRow& emp) {
+            auto perf = performanceMap.find(emp.id);
+            if (perf == performanceMap.end() || (!dept.empty() && emp.department != dept)) return;
+            const Performance& p = perf->second;
+            table.integer(emp.id);
+            table.text(emp.name);
+            table.text(emp.department.str());
+            table.decimal(p.getAttendancePercentage());
+            table.integer(p.getTotalOvertimeHours());
+            table.integer(p.getProjectsCompleted());
+            table.integer(p.getOnTimeSubmissions());
+            table.decimal(p.getPerformanceScore());
+            table.text(p.getPerformanceGrade());
+            table.integer((long long)leaderboard.rankOf(emp.id));
+            table.endRow();
+        });
+        return table.rowCount();
+    }
+
+    // What yearEndEvaluation would do with the latest scores, without
+    // applying anything: same bands, same raise arithmetic.
+    size_t exportYearEndOutcomes(ExportWriter& writer, ExportFormat fmt, const ExportFilter& filter) {
+        ExportTable table(writer, fmt, {"employeeId", "name", "department", "position", "score", "grade",
+                                        "action", "currentSalary", "newSalary"});
+        Symbol dept;
+        if (!filter.department.empty() && !Symbol::find(filter.department, dept)) {
+            return table.rowCount(); // no record holds that department
+        }
+        auto view = pinEmployees();
+        view.forEach([&](const EmployeeSnapshotRow& emp) {
+            auto perf = performanceMap.find(emp.id);
+            if (perf == performanceMap.end() || (!dept.empty() && emp.department != dept)) return;
+            const Performance& p = perf->second;
+            int band = RaiseBands::bandForScore(p.getPerformanceScore());
+            double increment = emp.salary * RaiseBands::rateForBand(band);
+            table.integer(emp.id);
+            table.text(emp.name);
+            table.text(emp.department.str());
+            table.text(emp.position.str());
+            table.decimal(p.getPerformanceScore());
+            table.text(p.getPerformanceGrade());
+            table.text(RaiseBands::actionForBand(band));
+            table.decimal(emp.salary);
+            table.decimal(emp.salary + increment);
+            table.endRow();
+        });
+        return table.rowCount();
+    }
+
+    double getTotalPayroll() {
+        ensureEmployeesLoaded();
+        return PayrollKernels::sum(salaryColumn.salaryData(), salaryColumn.size());
+    }
+
+    void displayPayrollSummary() {
+        ensureEmployeesLoaded();
+        size_t n = salaryColumn.size();
+        if (n == 0) {
+            cout << "\nNo employees found.\n";
+            return;
+        }
+
+        double total = getTotalPayroll();
+        vector<size_t> buckets = PayrollKernels::histogram(salaryColumn.salaryData(), n,
+                                                           SALARY_BUCKET_WIDTH, SALARY_BUCKET_COUNT);
+
+        cout << "\n========================================\n";
+        cout << "           PAYROLL SUMMARY\n";
+        cout << "========================================\n";
+        cout << "Headcount: " << n << endl;
+        cout << "Total Payroll: $" << fixed << setprecision(2) << total << endl;
+        cout << "Average Salary: $" << fixed << setprecision(2) << total / n << endl;
+        cout << "----------------------------------------\n";
+        cout << "Salary Distribution:\n";
+        for (size_t b = 0; b < buckets.size(); b++) {
+            string label = "$" + to_string((long long)(b * SALARY_BUCKET_WIDTH)) +
+                           (b + 1 < buckets.size()
+                                ? " - $" + to_string((long long)((b + 1) * SALARY_BUCKET_WIDTH))
+                                : "+");
+            cout << left << setw(22) << label << buckets[b] << endl;
+        }
+        cout << "========================================\n";
+    }
+
+    // Notice Management
+    void postNotice(string title, string content, string type) {
+        ensureNoticesLoaded();
+        Notice notice(nextNoticeId++, title, content, getCurrentDate(), type);
+        notices.push_back(notice);
+        noticeFeed.add(notice.getTypeSymbol(), notices.size() - 1);
+        noticeIndex.addDocument(notice.getNoticeId(), noticeSearchText(notice));
+        noticesDirty = true;
+        saveNotices();
+        cout << "\nNotice posted successfully!\n";
+    }
+
+    // Up to limit notices posted before beforeId (0 = from the newest),
+    // newest first. A blank type means every type.
+    vector<const Notice*> getNoticePage(string type, int beforeId, size_t limit) {
+        ensureNoticesLoaded();
+        vector<const Notice*> page;
+        if (type.empty()) {
+            size_t end = notices.size();
+            if (beforeId > 0) {
+                end = lower_bound(notices.begin(), notices.end(), beforeId,
+                                  [](const Notice& n, int id) { return n.getNoticeId() < id; })
+                      - notices.begin();
+            }
+            for (size_t i = end; i > 0 && page.size() < limit; i--) {
+                page.push_back(&notices[i - 1]);
+            }
+            return page;
+        }
+
+        Symbol typeSymbol;
+        if (!Symbol::find(type, typeSymbol)) return page; // no notice of that type
+        const vector<size_t>& positions = noticeFeed.positionsFor(typeSymbol);
+        size_t end = positions.size();
+        if (beforeId > 0) {
+            end = lower_bound(positions.begin(), positions.end(), beforeId,
+                              [this](size_t pos, int id) { return notices[pos].getNoticeId() < id; })
+                  - positions.begin();
+        }
+        for (size_t i = end; i > 0 && page.size() < limit; i--) {
+            page.push_back(&notices[positions[i - 1]]);
+        }
+        return page;
+    }
+
+    // Shows one page; returns the cursor for the next (older) page, or 0
+    // when there is none. With a readerId, the shown notices count as read
+    // by that employee.
+    int displayNoticePage(string type, int beforeId, int readerId = 0) {
+        vector<const Notice*> page = getNoticePage(type, beforeId, NOTICE_PAGE_SIZE + 1);
+        if (page.empty()) {
+            cout << "\nNo " << (beforeId > 0 ? "older " : "") << "notices available.\n";
+            return 0;
+        }
+        bool more = page.size() > NOTICE_PAGE_SIZE;
+        if (more) page.pop_back();
+
+        cout << "\n========================================\n";
+        cout << "           NOTICE BOARD";
+        if (!type.empty()) cout << " (" << type << ")";
+        cout << "\n========================================\n";
+        for (const Notice* notice : page) {
+            notice->display();
+            if (readerId > 0) markNoticeRead(notice->getNoticeId(), readerId);
+        }
+        return more ? page.back()->getNoticeId() : 0;
+    }
+
+    // Moves notices dated before cutoffDate from notices.dat to the archive
+    // file, so the hot set (and every page read from it) stays small.
+    void archiveNoticesBefore(string cutoffDate) {
+        int cutoffDay;
+        if (!DateUtils::parseDate(cutoffDate, cutoffDay)) {
+            cout << "Invalid date! Use YYYY-MM-DD.\n";
+            return;
+        }
+        ensureNoticesLoaded();
+        vector<Notice> kept;
+        vector<Notice> archived;
+        kept.reserve(notices.size());
+        for (const auto& notice : notices) {
+            int day;
+            if (DateUtils::parseDate(notice.getDate(), day) && day < cutoffDay) {
+                archived.push_back(notice);
+            } else {
+                kept.push_back(notice);
+            }
+        }
+        if (archived.empty()) {
+            cout << "\nNo notices dated before " << cutoffDate << ".\n";
+            return;
+        }
+
+        ofstream out(NOTICE_ARCHIVE_FILE, ios::app);
+        if (!out.is_open()) {
+            cout << "Error: Could not open " << NOTICE_ARCHIVE_FILE << "!\n";
+            return;
+        }
+        for (const auto& notice : archived) {
+            notice.saveToFile(out);
+            noticeIndex.removeDocument(notice.getNoticeId());
+            if (noticeReads.erase(notice.getNoticeId())) noticeReadsDirty = true;
+        }
+        out.close();
+        noticesReadCount.clear();
+
+        notices.swap(kept);
+        rebuildNoticeFeed();
+        noticesDirty = true;
+        saveNotices();
+        cout << "\n" << archived.size() << " notice(s) archived to " << NOTICE_ARCHIVE_FILE
+             << "; " << notices.size() << " remain on the board.\n";
+    }
+
+    void rebuildNoticeFeed() {
+        noticeFeed.clear();
+        for (size_t i = 0; i < notices.size(); i++) {
+            noticeFeed.add(notices[i].getTypeSymbol(), i);
+        }
+    }
+
+    // Read Receipts
+    void markNoticeRead(int noticeId, int empId) {
+        if (!noticeReads[noticeId].add((uint32_t)empId)) return;
+        noticeReadsDirty = true;
+        auto counted = noticesReadCount.find(empId);
+        if (counted != noticesReadCount.end()) counted->second++;
+    }
+
+    bool hasReadNotice(int noticeId, int empId) {
+        ensureNoticesLoaded();
+        auto it = noticeReads.find(noticeId);
+        return it != noticeReads.end() && it->second.contains((uint32_t)empId);
+    }
+
+    // Notices on the board the employee has not opened yet. The overall count
+    // is O(1) after the employee's first query; a per-type count walks that
+    // type's notices.
+    size_t getUnreadNoticeCount(int empId, string type = "") {
+        ensureNoticesLoaded();
+        if (type.empty()) {
+            auto counted = noticesReadCount.find(empId);
+            if (counted == noticesReadCount.end()) {
+                size_t read = 0;
+                for (const auto& entry : noticeReads) read += entry.second.contains((uint32_t)empId) ? 1 : 0;
+                counted = noticesReadCount.emplace(empId, read).first;
+            }
+            return notices.size() - counted->second;
+        }
+        size_t unread = 0;
+        auto countIfUnread = [&](const Notice& notice) {
+            auto it = noticeReads.find(notice.getNoticeId());
+            if (it == noticeReads.end() || !it->second.contains((uint32_t)empId)) unread++;
+        };
+        Symbol typeSymbol;
+        if (!Symbol::find(type, typeSymbol)) return 0;
+        for (size_t pos : noticeFeed.positionsFor(typeSymbol)) countIfUnread(notices[pos]);
+        return unread;
+    }
+
+    void displayUnreadCount(int empId) {
+        if (!findEmployeeById(empId)) {
+            cout << "Employee not found!\n";
+            return;
+        }
+        cout << "\nEmployee " << empId << " has " << getUnreadNoticeCount(empId)
+             << " unread notice(s), " << getUnreadNoticeCount(empId, "Urgent") << " of them Urgent.\n";
+    }
+
+    void displayNoticeReadStatus(int noticeId) {
+        Notice* notice = findNoticeById(noticeId);
+        if (!notice) {
+            cout << "Notice not found!\n";
+            return;
+        }
+        ensureEmployeesLoaded();
+        static const RoaringBitmap noReads;
+        auto it = noticeReads.find(noticeId);
+        const RoaringBitmap& reads = (it == noticeReads.end()) ? noReads : it->second;
+        size_t total = employeeIdSet.cardinality();
+        size_t read = employeeIdSet.andCardinality(reads);
+
+        cout << "\n========================================\n";
+        cout << "   READ STATUS: NOTICE " << noticeId << " [" << notice->getType() << "]\n";
+        cout << "========================================\n";
+        cout << "Title: " << notice->getTitle() << endl;
+        cout << "Read: " << read << " / " << total << "   Not read: " << total - read << endl;
+        if (read < total) {
+            cout << "\nNot read by:\n";
+            cout << left << setw(8) << "ID" << "Name" << endl;
+            cout << "----------------------------------------\n";
+            size_t shown = 0;
+            employeeIdSet.forEachNotIn(reads, [&](uint32_t empId) {
+                Employee* emp = findEmployeeById((int)empId);
+                cout << left << setw(8) << empId << (emp ? emp->getName() : "") << endl;
+                return ++shown < NOTICE_UNREAD_LIST_LIMIT;
+            });
+            if (total - read > shown) cout << "... and " << total - read - shown << " more\n";
+        }
+        cout << "========================================\n";
+    }
+
+    Notice* findNoticeById(int nid) {
+        ensureNoticesLoaded();
+        auto it = lower_bound(notices.begin(), notices.end(), nid,
+                              [](const Notice& n, int id) { return n.getNoticeId() < id; });
+        if (it != notices.end() && it->getNoticeId() == nid) {
+            return &*it;
+        }
+        return nullptr;
+    }
+
+    vector<Notice> getNoticesByType(string type) {
+        ensureNoticesLoaded();
+        vector<Notice> filtered;
+        Symbol typeSymbol;
+        if (!Symbol::find(type, typeSymbol)) return filtered;
+        for (size_t pos : noticeFeed.positionsFor(typeSymbol)) {
+            filtered.push_back(notices[pos]);
+        }
+        return filtered;
+    }
+
+    // Query Language
+    // Field access for Query::matches
+    struct EmployeeQueryRow {
+        const Employee& emp;
+        double number(Query::FieldId f) const {
+            if (f == Query::EMP_ID) return emp.getId();
+            if (f == Query::EMP_SALARY) return emp.getSalary();
+            return (double)emp.getProjectCount();
+        }
+        string text(Query::FieldId f) const {
+            if (f == Query::EMP_NAME) return emp.getName();
+            if (f == Query::EMP_EMAIL) return emp.getEmail();
+            return emp.getPhone();
+        }
+        Symbol symbol(Query::FieldId f) const {
+            return f == Query::EMP_DEPARTMENT ? emp.getDepartmentSymbol() : emp.getPositionSymbol();
+        }
+        bool day(Query::FieldId, int& out) const {
+            return DateUtils::parseDate(emp.getJoiningDate(), out);
+        }
+    };
+
+    struct ProjectQueryRow {
+        const Project& proj;
+        double number(Query::FieldId f) const {
+            return f == Query::PROJ_ID ? proj.getProjectId() : proj.getEmployeeId();
+        }
+        string text(Query::FieldId) const { return proj.getTitle(); }
+        Symbol symbol(Query::FieldId f) const {
+            if (f == Query::PROJ_STATUS) return proj.getStatusSymbol();
+            if (f == Query::PROJ_TYPE) return proj.getProjectTypeSymbol();
+            return proj.getAssignedToSymbol();
+        }
+        bool day(Query::FieldId f, int& out) const {
+            return DateUtils::parseDate(f == Query::PROJ_DEADLINE ? proj.getDeadline()
+                                                                  : proj.getSubmissionDate(), out);
+        }
+    };
+
+    static void collectConjuncts(const Query::Program& program, int n, vector<int>& out) {
+        const Query::Node& node = program.nodes[n];
+        if (node.kind == Query::Node::AND) {
+            collectConjuncts(program, node.left, out);
+            collectConjuncts(program, node.right, out);
+        } else {
+            out.push_back(n);
+        }
+    }
+
+    // Cheapest first: numbers, then interned-symbol equality, then dates
+    // (parsed per row), then string work, then nested and/or/not.
+    static int conjunctCost(const Query::Node& node) {
+        if (node.kind != Query::Node::COMPARE) return 5;
+        if (node.type == Query::NUMBER) return 0;
+        if (node.type == Query::SYMBOL) return (node.op == Query::EQ || node.op == Query::NE) ? 1 : 3;
+        if (node.type == Query::DATE) return 2;
+        return 4;
+    }
+
+    // Parses, plans and runs a query; with explain, prints the plan, the
+    // rows surviving each step and the timings instead of the rows.
+    void runQuery(string text, bool explain) {
+        auto began = chrono::steady_clock::now();
+        Query::Program program;
+        Query::Parser parser;
+        if (!parser.parse(text, program)) {
+            cout << "Query error: " << parser.getError() << endl;
+            return;
+        }
+        auto parsed = chrono::steady_clock::now();
+        bool onEmployees = program.entity == Query::EMPLOYEES;
+        if (onEmployees) ensureEmployeesLoaded();
+        else ensureProjectsLoaded();
+        size_t rowCount = onEmployees ? employees.size() : projects.size();
+        Query::bindSymbols(program);
+        auto loaded = chrono::steady_clock::now();
+
+        // Access path: the most selective equality an index can answer
+        vector<int> conjuncts;
+        if (program.root >= 0) collectConjuncts(program, program.root, conjuncts);
+        int indexed = -1;
+        vector<size_t> rows;
+        string access;
+        for (size_t c = 0; c < conjuncts.size(); c++) {
+            const Query::Node& node = program.nodes[conjuncts[c]];
+            if (node.kind != Query::Node::COMPARE || node.op != Query::EQ) continue;
+            vector<size_t> found;
+            string how;
+            if (node.field == Query::EMP_DEPARTMENT || node.field == Query::EMP_POSITION) {
+                bool byDept = node.field == Query::EMP_DEPARTMENT;
+                const GroupIndex& index = byDept ? departmentIndex : positionIndex;
+                for (int id : index.getMembers(node.text)) {
+                    auto it = employeeRowById.find(id);
+                    if (it != employeeRowById.end()) found.push_back(it->second);
+                }
+                how = byDept ? "department index" : "position index";
+            } else if (node.field == Query::EMP_ID || node.field == Query::PROJ_ID) {
+                const auto& rowById = onEmployees ? employeeRowById : projectRowById;
+                auto it = rowById.find((int)node.number);
+                if (it != rowById.end() && it->first == node.number) found.push_back(it->second);
+                how = onEmployees ? "employee ID map" : "project ID map";
+            } else if (node.field == Query::PROJ_EMPLOYEE_ID) {
+                auto it = projectRowsByEmployee.find((int)node.number);
+                if (it != projectRowsByEmployee.end() && it->first == node.number) found = it->second;
+                how = "employee project map";
+            } else {
+                continue;
+            }
+            if (indexed < 0 || found.size() < rows.size()) {
+                indexed = (int)c;
+                rows.swap(found);
+                access = how;
+            }
+        }
+
+        vector<int> residual;
+        for (size_t c = 0; c < conjuncts.size(); c++) {
+            if ((int)c != indexed) residual.push_back(conjuncts[c]);
+        }
+        stable_sort(residual.begin(), residual.end(), [&program](int a, int b) {
+            return conjunctCost(program.nodes[a]) < conjunctCost(program.nodes[b]);
+        });
+        auto planned = chrono::steady_clock::now();
+
+        // Execution over a selection vector, one conjunct at a time
+        vector<string> steps;
+        vector<size_t> rowsAfter;
+        size_t firstFilter = 0;
+        if (indexed >= 0) {
+            sort(rows.begin(), rows.end());
+            rows.erase(unique(rows.begin(), rows.end()), rows.end());
+            steps.push_back("Index lookup: " + Query::describe(program, conjuncts[indexed]) + " via " + access);
+        } else if (onEmployees && !residual.empty() &&
+                   program.nodes[residual[0]].kind == Query::Node::COMPARE &&
+                   program.nodes[residual[0]].field == Query::EMP_SALARY) {
+            // Tight loop over the contiguous salary column
+            const Query::Node& node = program.nodes[residual[0]];
+            const double* salaries = salaryColumn.salaryData();
+            rows.reserve(rowCount / 4);
+            for (size_t i = 0; i < rowCount; i++) {
+                if (Query::compareValues(salaries[i], node.op, node.number)) rows.push_back(i);
+            }
+            steps.push_back("Columnar scan: " + Query::describe(program, residual[0]) +
+                            " over salary column (" + to_string(rowCount) + " rows)");
+            firstFilter = 1;
+        } else {
+            rows.resize(rowCount);
+            for (size_t i = 0; i < rowCount; i++) rows[i] = i;
+            steps.push_back("Full scan (" + to_string(rowCount) + " rows)");
+        }
+        rowsAfter.push_back(rows.size());
+
+        for (size_t r = firstFilter; r < residual.size(); r++) {
+            int node = residual[r];
+            size_t kept = 0;
+            for (size_t i = 0; i < rows.size(); i++) {
+                bool keep = onEmployees ? Query::matches(program, node, EmployeeQueryRow{employees[rows[i]]})
+                                        : Query::matches(program, node, ProjectQueryRow{projects[rows[i]]});
+                if (keep) rows[kept++] = rows[i];
+            }
+            rows.resize(kept);
+            steps.push_back("Filter: " + Query::describe(program, node));
+            rowsAfter.push_back(rows.size());
+        }
+        auto finished = chrono::steady_clock::now();
+
+        auto ms = [](chrono::steady_clock::time_point a, chrono::steady_clock::time_point b) {
+            return chrono::duration<double, milli>(b - a).count();
+        };
+        if (explain) {
+            cout << "\n================================================\n";
+            cout << "              QUERY PLAN\n";
+            cout << "================================================\n";
+            cout << "Source: " << (onEmployees ? "employees" : "projects") << " (" << rowCount << " rows)\n";
+            for (size_t i = 0; i < steps.size(); i++) {
+                cout << "  " << i + 1 << ". " << left << setw(66) << steps[i]
+                     << " -> " << rowsAfter[i] << " rows\n";
+            }
+            cout << fixed << setprecision(3);
+            cout << "Time: parse " << ms(began, parsed) << " ms, load " << ms(parsed, loaded)
+                 << " ms, plan " << ms(loaded, planned)
+                 << " ms, execute " << ms(planned, finished) << " ms\n";
+            cout << "================================================\n";
+            return;
+        }
+
+        cout << "\n================================================\n";
+        cout << "              QUERY RESULTS\n";
+        cout << "================================================\n";
+        if (onEmployees) {
+            cout << left << setw(8) << "ID" << setw(20) << "Name" << setw(15) << "Department"
+                 << setw(15) << "Position" << setw(12) << "Salary" << "Joined" << endl;
+        } else {
+            cout << left << setw(8) << "Proj ID" << setw(25) << "Title" << setw(8) << "Emp"
+                 << setw(12) << "Status" << setw(11) << "Type" << "Deadline" << endl;
+        }
+        cout << "------------------------------------------------\n";
+        size_t shown = min(rows.size(), QUERY_RESULT_LIMIT);
+        for (size_t i = 0; i < shown; i++) {
+            if (onEmployees) {
+                const Employee& emp = employees[rows[i]];
+                cout << left << setw(8) << emp.getId() << setw(20) << emp.getName()
+                     << setw(15) << emp.getDepartment() << setw(15) << emp.getPosition()
+                     << setw(12) << fixed << setprecision(2) << emp.getSalary()
+                     << emp.getJoiningDate() << endl;
+            } else {
+                const Project& proj = projects[rows[i]];
+                cout << left << setw(8) << proj.getProjectId() << setw(25) << proj.getTitle()
+                     << setw(8) << proj.getEmployeeId() << setw(12) << proj.getStatus()
+                     << setw(11) << proj.getProjectType() << proj.getDeadline() << endl;
+            }
+        }
+        if (rows.size() > shown) cout << "... and " << rows.size() - shown << " more\n";
+        cout << "------------------------------------------------\n";
+        cout << rows.size() << " row(s) in " << fixed << setprecision(3) << ms(loaded, finished) << " ms";
+        if (ms(parsed, loaded) >= 1) cout << " (+" << ms(parsed, loaded) << " ms loading data)";
+        cout << "\n";
+    }
+
+    // Search
+    static string noticeSearchText(const Notice& notice) {
+        return notice.getTitle() + " " + notice.getContent();
+    }
+
+    static string projectSearchText(const Project& proj) {
+        return proj.getTitle() + " " + proj.getDescription() + " " + proj.getFeedback();
+    }
+
+    void searchNoticesAndProjects(string query) {
+        ensureNoticesLoaded();
+        ensureProjectsLoaded();
+        vector<pair<int, double>> noticeHits = noticeIndex.search(query, SEARCH_RESULT_LIMIT);
+        vector<pair<int, double>> projectHits = projectIndex.search(query, SEARCH_RESULT_LIMIT);
+
+        cout << "\n================================================\n";
+        cout << "              SEARCH RESULTS\n";
+        cout << "================================================\n";
+        cout << "Notices (" << noticeHits.size() << "):\n";
+        cout << left << setw(8) << "Score" << setw(8) << "ID" << setw(14) << "Type"
+             << "Title" << endl;
+        cout << "------------------------------------------------\n";
+        for (const auto& hit : noticeHits) {
+            Notice* notice = findNoticeById(hit.first);
+            if (!notice) continue;
+            cout << left << setw(8) << fixed << setprecision(2) << hit.second
+                 << setw(8) << notice->getNoticeId() << setw(14) << notice->getType()
+                 << notice->getTitle() << endl;
+        }
+
+        cout << "\nProjects (" << projectHits.size() << "):\n";
+        cout << left << setw(8) << "Score" << setw(8) << "Proj ID" << setw(25) << "Title"
+             << setw(20) << "Assigned To" << "Status" << endl;
+        cout << "------------------------------------------------\n";
+        ensureProjectsLoaded();
+        for (const auto& hit : projectHits) {
+            auto it = projectRowById.find(hit.first);
+            if (it == projectRowById.end()) continue;
+            const Project& proj = projects[it->second];
+            cout << left << setw(8) << fixed << setprecision(2) << hit.second
+                 << setw(8) << proj.getProjectId() << setw(25) << proj.getTitle()
+                 << setw(20) << proj.getAssignedTo() << proj.getStatus() << endl;
+        }
+        cout << "================================================\n";
+    }
+
+    // Recruitment Management
+    void addCandidate(string name, string email, string phone, string position) {
+        if (!isValidName(name) || !isValidEmail(email) || !isValidPhone(phone)) {
+            cout << "Invalid candidate details!\n";
+            return;
+        }
+
+        ensureCandidatesLoaded();
+        string emailKey = normalizeEmail(email);
+        auto existing = candidateEmailIndex.find(emailKey);
+        if (existing != candidateEmailIndex.end()) {
+            Candidate* other = findCandidateById(existing->second);
+            cout << "A candidate with this email already exists (ID: " << existing->second;
+            if (other) cout << ", " << other->getPosition() << ", " << other->getStatus();
+            cout << ")!\n";
+            return;
+        }
+
+        Candidate candidate(nextCandidateId++, name, email, phone,
+                          position, getCurrentDate());
+        candidates.push_back(candidate);
+        candidateEmailIndex[emailKey] = candidate.getCandidateId();
+        recruitmentFunnel.add(candidate.getPositionSymbol(), candidate.getStatusSymbol());
+        candidatesDirty = true;
+        saveCandidates();
+        cout << "\nCandidate added successfully! ID: " << candidate.getCandidateId() << endl;
+    }
+
+    Candidate* findCandidateById(int cid) {
+        ensureCandidatesLoaded();
+        for (size_t i = 0; i < candidates.size(); i++) {
+            if (candidates[i].getCandidateId() == cid) {
+                return &candidates[i];
+            }
+        }
+        return nullptr;
+    }
+
+    void updateCandidateStatus(int candidateId, string newStatus, string interviewDate = "") {
+        Candidate* candidate = findCandidateById(candidateId);
+        if (!candidate) {
+            cout << "Candidate not found!\n";
+            return;
+        }
+
+        Symbol status;
+        if (!RecruitmentFunnel::parseStatus(newStatus, status)) {
+            cout << "Invalid status! Use Applied, Interview Scheduled, Selected or Rejected.\n";
+            return;
+        }
+
+        recruitmentFunnel.move(candidate->getPositionSymbol(), candidate->getStatusSymbol(), status);
+        candidate->setStatus(status);
+        if (interviewDate != "") {
+            candidate->setInterviewDate(interviewDate);
+        }
+        candidatesDirty = true;
+        saveCandidates();
+        cout << "\nCandidate status updated!\n";
+
+        string body = "Dear " + candidate->getName() + ",\n\nYour application for " +
+                      candidate->getPosition() + " is now: " + newStatus + ".\n";
+        if (interviewDate != "") body += "Interview date: " + interviewDate + "\n";
+        queueEmail(candidate->getEmail(), "Your application for " + candidate->getPosition(), body);
+    }
+
+    // Lower-cased, surrounding whitespace dropped
+    static string normalizeEmail(const string& email) {
+        size_t first = email.find_first_not_of(" \t");
+        if (first == string::npos) return "";
+        size_t last = email.find_last_not_of(" \t");
+        string key = email.substr(first, last - first + 1);
+        for (char& ch : key) ch = (char)tolower((unsigned char)ch);
+        return key;
+    }
+
+    int getCandidateCount(string position, string status) {
+        ensureCandidatesLoaded();
+        Symbol positionSymbol, statusSymbol;
+        if (!Symbol::find(position, positionSymbol) || !Symbol::find(status, statusSymbol)) return 0;
+        return recruitmentFunnel.count(positionSymbol, statusSymbol);
+    }
+
+    // Per-position funnel straight from the maintained counters.
+    void displayRecruitmentFunnel() {
+        ensureCandidatesLoaded();
+        cout << "\n================================================================================\n";
+        cout << "                      RECRUITMENT FUNNEL\n";
+        cout << "================================================================================\n";
+        vector<string> positions = recruitmentFunnel.positions();
+        if (positions.empty()) {
+            cout << "No candidates found.\n";
+            cout << "================================================================================\n";
+            return;
+        }
+        cout << left << setw(20) << "Position" << setw(9) << "Applied" << setw(11) << "Interview"
+             << setw(10) << "Selected" << setw(10) << "Rejected" << setw(7) << "Total"
+             << setw(13) << "Interview %" << "Selected %" << endl;
+        cout << "--------------------------------------------------------------------------------\n";
+        for (const auto& position : positions) {
+            printFunnelRow(position, recruitmentFunnel.countsFor(Symbol(position)));
+        }
+        cout << "--------------------------------------------------------------------------------\n";
+        printFunnelRow("All Positions", recruitmentFunnel.totals());
+        cout << "================================================================================\n";
+        cout << "Interview % = reached interview (scheduled or selected) / total\n";
+    }
+
+    void printFunnelRow(const string& label, const RecruitmentFunnel::Counts& counts) {
+        int total = RecruitmentFunnel::total(counts);
+        int interviewed = counts[RecruitmentFunnel::INTERVIEW] + counts[RecruitmentFunnel::SELECTED];
+        cout << left << setw(20) << label
+             << setw(9) << counts[RecruitmentFunnel::APPLIED]
+             << setw(11) << counts[RecruitmentFunnel::INTERVIEW]
+             << setw(10) << counts[RecruitmentFunnel::SELECTED]
+             << setw(10) << counts[RecruitmentFunnel::REJECTED]
+             << setw(7) << total << fixed << setprecision(1)
+             << setw(13) << (total ? 100.0 * interviewed / total : 0.0)
+             << (total ? 100.0 * counts[RecruitmentFunnel::SELECTED] / total : 0.0) << endl;
+    }
+
+    void displayAllCandidates() {
+        ensureCandidatesLoaded();
+        if (candidates.empty()) {
+            cout << "\nNo candidates found.\n";
+            return;
+        }
+
+        cout << "\n========================================\n";
+        cout << "          CANDIDATE LIST\n";
+        cout << "========================================\n";
+        for (const auto& candidate : candidates) {
+            candidate.display();
+        }
+    }
+
+    vector<Candidate> getCandidatesByStatus(string status) {
+        ensureCandidatesLoaded();
+        vector<Candidate> filtered;
+        Symbol wanted;
+        if (!Symbol::find(status, wanted)) return filtered;
+        for (const auto& candidate : candidates) {
+            if (candidate.getStatusSymbol() == wanted) {
+                filtered.push_back(candidate);
+            }
+        }
+        return filtered;
+    }
 
     // Leave Management
     void submitLeaveRequest(int empId, string startDate, string endDate, string reason) {
@@ -554,20 +2097,156 @@ public:
             return;
         }
 
+        int fromDay, toDay;
+        if (!DateUtils::parseDate(startDate, fromDay) || !DateUtils::parseDate(endDate, toDay)) {
+            cout << "Invalid date! Use YYYY-MM-DD.\n";
+            return;
+        }
+        if (fromDay > toDay) {
+            cout << "End date must not be before start date!\n";
+            return;
+        }
+
+        ensureLeaveRequestsLoaded();
+        vector<LeaveInterval> overlaps = leaveCalendar.overlapping(fromDay, toDay);
+        const set<int>& team = departmentIndex.getMembers(emp->getDepartment());
+        set<int> teammatesOut;
+        for (const auto& other : overlaps) {
+            if (other.employeeId == empId) {
+                cout << "This overlaps your leave request #" << other.requestId << " ("
+                     << DateUtils::formatDate(other.startDay) << " to "
+                     << DateUtils::formatDate(other.endDay) << ")!\n";
+                return;
+            }
+            if (team.count(other.employeeId)) teammatesOut.insert(other.employeeId);
+        }
+
         LeaveRequest leave(nextLeaveRequestId++, empId, emp->getName(),
                           startDate, endDate, reason, getCurrentDate());
+        leaveRowById.emplace(leave.getRequestId(), leaveRequests.size());
         leaveRequests.push_back(leave);
+        indexLeave(leave);
+        leaveRequestsDirty = true;
         saveLeaveRequests();
         cout << "\nLeave request submitted successfully!\n";
+        LeaveBalance balance;
+        if (getLeaveBalance(empId, startDate, balance) && toDay - fromDay + 1 > balance.remaining()) {
+            cout << "Note: this request is " << (toDay - fromDay + 1) << " day(s) but your leave balance on "
+                 << startDate << " is " << fixed << setprecision(1) << balance.remaining() << " day(s).\n";
+        }
+        if (!teammatesOut.empty()) {
+            cout << "Note: " << teammatesOut.size() << " other employee(s) in " << emp->getDepartment()
+                 << " are on leave during part of this period.\n";
+        }
     }
 
-    LeaveRequest* findLeaveRequestById(int rid) {
-        for (size_t i = 0; i < leaveRequests.size(); i++) {
-            if (leaveRequests[i].getRequestId() == rid) {
-                return &leaveRequests[i];
+    // Adds a pending/approved leave to the calendar; legacy records whose
+    // dates are not YYYY-MM-DD stay out of it.
+    void indexLeave(const LeaveRequest& leave) {
+        static const Symbol REJECTED("Rejected");
+        if (leave.getStatusSymbol() == REJECTED) return;
+        int fromDay, toDay;
+        if (!DateUtils::parseDate(leave.getStartDate(), fromDay) ||
+            !DateUtils::parseDate(leave.getEndDate(), toDay) || fromDay > toDay) {
+            return;
+        }
+        leaveCalendar.insert({fromDay, toDay, leave.getRequestId(), leave.getEmployeeId()});
+    }
+
+    void unindexLeave(const LeaveRequest& leave) {
+        int fromDay;
+        if (DateUtils::parseDate(leave.getStartDate(), fromDay)) {
+            leaveCalendar.remove(fromDay, leave.getRequestId());
+        }
+    }
+
+    // Everyone with pending or approved leave covering the given day.
+    void displayWhoIsOut(string date) {
+        int day;
+        if (!DateUtils::parseDate(date, day)) {
+            cout << "Invalid date! Use YYYY-MM-DD.\n";
+            return;
+        }
+        ensureLeaveRequestsLoaded();
+        ensureEmployeesLoaded();
+        vector<LeaveInterval> out = leaveCalendar.stab(day);
+
+        cout << "\n============================================================\n";
+        cout << "        ON LEAVE: " << DateUtils::formatDate(day) << "\n";
+        cout << "============================================================\n";
+        if (out.empty()) {
+            cout << "Nobody is on leave.\n";
+        } else {
+            cout << left << setw(8) << "Emp ID" << setw(20) << "Name" << setw(15) << "Department"
+                 << setw(24) << "Leave" << "Status" << endl;
+            cout << "------------------------------------------------------------\n";
+            for (const auto& leave : out) {
+                auto empRow = employeeRowById.find(leave.employeeId);
+                auto leaveRow = leaveRowById.find(leave.requestId);
+                const Employee* emp = empRow == employeeRowById.end() ? nullptr : &employees[empRow->second];
+                cout << left << setw(8) << leave.employeeId
+                     << setw(20) << (emp ? emp->getName() : "?")
+                     << setw(15) << (emp ? emp->getDepartment() : "?")
+                     << setw(24) << (DateUtils::formatDate(leave.startDay) + " - " +
+                                     DateUtils::formatDate(leave.endDay))
+                     << (leaveRow == leaveRowById.end() ? "?" : leaveRequests[leaveRow->second].getStatus())
+                     << endl;
             }
         }
-        return nullptr;
+        cout << "============================================================\n";
+    }
+
+    // Day-by-day staffing of a department over [fromDate, toDate], counting
+    // pending and approved leave.
+    void displayDepartmentCoverage(string department, string fromDate, string toDate) {
+        int from, to;
+        if (!DateUtils::parseDate(fromDate, from) || !DateUtils::parseDate(toDate, to) || from > to) {
+            cout << "Invalid date range! Use YYYY-MM-DD, start before end.\n";
+            return;
+        }
+        if (to - from >= LEAVE_COVERAGE_MAX_DAYS) {
+            cout << "Range too long (max " << LEAVE_COVERAGE_MAX_DAYS << " days).\n";
+            return;
+        }
+        ensureEmployeesLoaded();
+        ensureLeaveRequestsLoaded();
+        GroupIndex::GroupStats stats;
+        if (!departmentIndex.getStats(department, stats)) {
+            cout << "Department not found!\n";
+            return;
+        }
+        const set<int>& members = departmentIndex.getMembers(department);
+
+        // Difference array over the range: +1 on a leave's first day, -1 after its last
+        vector<int> delta(to - from + 2, 0);
+        for (const auto& leave : leaveCalendar.overlapping(from, to)) {
+            if (!members.count(leave.employeeId)) continue;
+            delta[max(leave.startDay, from) - from]++;
+            delta[min(leave.endDay, to) - from + 1]--;
+        }
+
+        cout << "\n================================================\n";
+        cout << "   LEAVE COVERAGE: " << department << "\n";
+        cout << "================================================\n";
+        cout << "Headcount: " << stats.count << endl;
+        cout << left << setw(14) << "Date" << setw(8) << "Out" << setw(12) << "Available"
+             << "Coverage" << endl;
+        cout << "------------------------------------------------\n";
+        int out = 0;
+        for (int day = from; day <= to; day++) {
+            out += delta[day - from];
+            int available = (int)stats.count - out;
+            cout << left << setw(14) << DateUtils::formatDate(day) << setw(8) << out
+                 << setw(12) << available << fixed << setprecision(1)
+                 << (stats.count ? 100.0 * available / stats.count : 0.0) << "%" << endl;
+        }
+        cout << "================================================\n";
+    }
+
+    LeaveRequest* findLeaveRequestById(int rid) {
+        ensureLeaveRequestsLoaded();
+        auto it = leaveRowById.find(rid);
+        return it == leaveRowById.end() ? nullptr : &leaveRequests[it->second];
     }
 
     void processLeaveRequest(int requestId, string decision) {
@@ -577,15 +2256,130 @@ public:
             return;
         }
 
+        static const Symbol APPROVED("Approved");
+        bool wasApproved = leave->getStatusSymbol() == APPROVED;
+        unindexLeave(*leave);
         leave->setStatus(decision);
+        indexLeave(*leave);
+        if (leaveLedgerBuilt) {
+            bool nowApproved = leave->getStatusSymbol() == APPROVED;
+            if (wasApproved && !nowApproved) {
+                leaveLedgerBuilt = false; // un-approving is rare; rebuild on next use
+            } else if (!wasApproved && nowApproved) {
+                debitLeave(*leave);
+            }
+        }
+        leaveRequestsDirty = true;
         saveLeaveRequests();
         cout << "\nLeave request " << decision << "!\n";
+
+        Employee* emp = findEmployeeById(leave->getEmployeeId());
+        if (emp) {
+            queueEmail(emp->getEmail(), "Leave request " + to_string(requestId) + " " + decision,
+                       "Your leave from " + leave->getStartDate() + " to " + leave->getEndDate() +
+                       " has been " + decision + ".\n");
+        }
+    }
+
+    // Leave Balances
+    void openLeaveAccount(const Employee& emp) {
+        int joiningDay;
+        if (DateUtils::parseDate(emp.getJoiningDate(), joiningDay)) {
+            leaveLedger.openAccount(emp.getId(), joiningDay);
+        }
+    }
+
+    void debitLeave(const LeaveRequest& leave) {
+        int fromDay, toDay;
+        if (DateUtils::parseDate(leave.getStartDate(), fromDay) &&
+            DateUtils::parseDate(leave.getEndDate(), toDay) && fromDay <= toDay) {
+            leaveLedger.debit(leave.getEmployeeId(), fromDay, toDay);
+        }
+    }
+
+    void ensureLeaveLedgerBuilt() {
+        ensureEmployeesLoaded();
+        ensureLeaveRequestsLoaded();
+        if (leaveLedgerBuilt) return;
+        leaveLedger.clear();
+        for (const auto& emp : employees) openLeaveAccount(emp);
+        static const Symbol APPROVED("Approved");
+        for (const auto& leave : leaveRequests) {
+            if (leave.getStatusSymbol() == APPROVED) debitLeave(leave);
+        }
+        leaveLedgerBuilt = true;
+    }
+
+    // asOfDate defaults to today; false if it is not YYYY-MM-DD.
+    bool getLeaveBalance(int empId, string asOfDate, LeaveBalance& balance) {
+        int day;
+        if (!DateUtils::parseDate(asOfDate.empty() ? getCurrentDate() : asOfDate, day)) return false;
+        ensureLeaveLedgerBuilt();
+        balance = leaveLedger.balanceAsOf(empId, day);
+        return true;
+    }
+
+    void displayLeaveBalance(int empId, string asOfDate) {
+        Employee* emp = findEmployeeById(empId);
+        if (!emp) {
+            cout << "Employee not found!\n";
+            return;
+        }
+        LeaveBalance balance;
+        if (!getLeaveBalance(empId, asOfDate, balance)) {
+            cout << "Invalid date! Use YYYY-MM-DD.\n";
+            return;
+        }
+        cout << "\n========================================\n";
+        cout << "            LEAVE BALANCE\n";
+        cout << "========================================\n";
+        cout << "Employee: " << emp->getName() << " (ID: " << empId << ")\n";
+        cout << "As Of: " << (asOfDate.empty() ? getCurrentDate() : asOfDate) << endl;
+        cout << fixed << setprecision(1);
+        cout << "Accrued: " << balance.accrued << " days\n";
+        cout << "Used (approved): " << balance.used << " days\n";
+        cout << "Remaining: " << balance.remaining() << " days\n";
+        cout << "========================================\n";
+    }
+
+    // Every employee's balance as of one date, in a single pass.
+    void displayLeaveBalanceReport(string asOfDate) {
+        int day;
+        if (!DateUtils::parseDate(asOfDate.empty() ? getCurrentDate() : asOfDate, day)) {
+            cout << "Invalid date! Use YYYY-MM-DD.\n";
+            return;
+        }
+        ensureLeaveLedgerBuilt();
+        cout << "\n========================================================================\n";
+        cout << "        LEAVE BALANCES AS OF " << DateUtils::formatDate(day) << "\n";
+        cout << "========================================================================\n";
+        cout << left << setw(8) << "Emp ID" << setw(20) << "Name" << setw(15) << "Department"
+             << setw(10) << "Accrued" << setw(8) << "Used" << "Remaining" << endl;
+        cout << "------------------------------------------------------------------------\n";
+        double totalAccrued = 0, totalRemaining = 0;
+        long long totalUsed = 0;
+        cout << fixed << setprecision(1);
+        for (const auto& emp : employees) {
+            LeaveBalance balance = leaveLedger.balanceAsOf(emp.getId(), day);
+            totalAccrued += balance.accrued;
+            totalUsed += balance.used;
+            totalRemaining += balance.remaining();
+            cout << left << setw(8) << emp.getId() << setw(20) << emp.getName()
+                 << setw(15) << emp.getDepartment() << setw(10) << balance.accrued
+                 << setw(8) << balance.used << balance.remaining() << endl;
+        }
+        cout << "------------------------------------------------------------------------\n";
+        cout << left << setw(43) << "Total" << setw(10) << totalAccrued << setw(8) << totalUsed
+             << totalRemaining << endl;
+        cout << "========================================================================\n";
     }
 
     vector<LeaveRequest> getPendingLeaveRequests() {
+        ensureLeaveRequestsLoaded();
         vector<LeaveRequest> pending;
+        static const Symbol PENDING("Pending");
         for (const auto& leave : leaveRequests) {
-            if (leave.getStatus() == "Pending") {
+            if (leave.getStatusSymbol() == PENDING) {
                 pending.push_back(leave);
             }
         }
@@ -593,37 +2387,115 @@ public:
     }
 
     // File Handling Functions
+    // Only collections modified since their last write are saved, so a
+    // read-only session exits without touching any file.
     void saveAllData() {
-        saveEmployees();
-        saveHRPassword();
-        saveProjects();
-        saveAttendance();
-        saveNotices();
-        saveCandidates();
-        saveLeaveRequests();
-        savePerformance();
+        if (employeesDirty) saveEmployees();
+        if (hrPasswordDirty) saveHRPassword();
+        if (projectsDirty) saveProjects();
+        if (attendanceDirty) saveAttendance();
+        if (noticesDirty) saveNotices();
+        if (candidatesDirty) saveCandidates();
+        if (leaveRequestsDirty) saveLeaveRequests();
+        if (performanceDirty) savePerformance();
+        if (noticeReadsDirty) saveNoticeReads();
     }
 
+    bool hasUnsavedChanges() const {
+        return employeesDirty || hrPasswordDirty || projectsDirty || attendanceDirty ||
+               noticesDirty || candidatesDirty || leaveRequestsDirty || performanceDirty ||
+               noticeReadsDirty;
+    }
+
+    // Eagerly loads every collection that has not been loaded yet. The files
+    // are independent, so their loaders run concurrently on a small pool and
+    // the total tracks the slowest file rather than the sum of all of them.
     void loadAllData() {
-        loadHRPassword();
+        vector<pair<string, function<void()>>> loaders;
+        if (!hrPasswordLoaded) loaders.push_back({HR_FILE, [this]() { loadHRPassword(); }});
+        if (!employeesLoaded) loaders.push_back({EMPLOYEE_FILE, [this]() { loadEmployees(); }});
+        if (!projectsLoaded) loaders.push_back({PROJECT_FILE, [this]() { loadProjects(); }});
+        if (!attendanceLoaded) loaders.push_back({ATTENDANCE_FILE, [this]() { loadAttendance(); }});
+        if (!noticesLoaded) loaders.push_back({NOTICE_FILE, [this]() { loadNotices(); }});
+        if (!candidatesLoaded) loaders.push_back({CANDIDATE_FILE, [this]() { loadCandidates(); }});
+        if (!leaveRequestsLoaded) loaders.push_back({LEAVE_FILE, [this]() { loadLeaveRequests(); }});
+        if (!performanceLoaded) loaders.push_back({PERFORMANCE_FILE, [this]() { loadPerformance(); }});
+
+        vector<double> elapsed(loaders.size(), 0.0);
+        vector<function<void()>> tasks;
+        for (size_t i = 0; i < loaders.size(); i++) {
+            tasks.push_back([&loaders, &elapsed, i]() {
+                auto start = chrono::steady_clock::now();
+                loaders[i].second();
+                elapsed[i] = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            });
+        }
+
+        auto start = chrono::steady_clock::now();
+        TaskPool().run(tasks);
+        lastLoadWallMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        // The ledger is derived from employees and leave requests; the loaders
+        // run in parallel, so it is invalidated here rather than by each one
+        leaveLedgerBuilt = false;
+
+        loadTimings.clear();
+        for (size_t i = 0; i < loaders.size(); i++) {
+            loadTimings[loaders[i].first] = elapsed[i];
+        }
+        ensureMailQueueStarted(); // resumes mail left from earlier runs
+    }
+
+    void displayLoadTimings() {
+        cout << "\n========================================\n";
+        cout << "        STARTUP LOAD TIMINGS\n";
+        cout << "========================================\n";
+        double sum = 0;
+        for (const auto& entry : loadTimings) {
+            cout << left << setw(24) << entry.first << fixed << setprecision(3)
+                 << entry.second << " ms\n";
+            sum += entry.second;
+        }
+        cout << "----------------------------------------\n";
+        cout << left << setw(24) << "Sum of files" << fixed << setprecision(3) << sum << " ms\n";
+        cout << left << setw(24) << "Wall time" << fixed << setprecision(3) << lastLoadWallMs << " ms\n";
+        cout << "========================================\n";
+    }
+
+    // On-demand loaders. ID counters (nextCandidateId etc.) are recovered by
+    // the collection's own loader, which every mutator triggers before it
+    // allocates a new ID.
+    void ensureHRPasswordLoaded() { if (!hrPasswordLoaded) loadHRPassword(); }
+    // A (re)load of employees or leave requests invalidates the leave ledger
+    void ensureEmployeesLoaded() {
+        if (employeesLoaded) return;
         loadEmployees();
-        loadProjects();
-        loadAttendance();
-        loadNotices();
-        loadCandidates();
+        leaveLedgerBuilt = false;
+    }
+    void ensureProjectsLoaded() { if (!projectsLoaded) loadProjects(); }
+    void ensureAttendanceLoaded() { if (!attendanceLoaded) loadAttendance(); }
+    void ensureNoticesLoaded() { if (!noticesLoaded) loadNotices(); }
+    void ensureCandidatesLoaded() { if (!candidatesLoaded) loadCandidates(); }
+    void ensureLeaveRequestsLoaded() {
+        if (leaveRequestsLoaded) return;
         loadLeaveRequests();
-        loadPerformance();
+        leaveLedgerBuilt = false;
     }
+    void ensurePerformanceLoaded() { if (!performanceLoaded) loadPerformance(); }
 
     void saveHRPassword() {
         ofstream out(HR_FILE);
         if (out.is_open()) {
             out << hrPassword << "\n";
             out.close();
+            hrPasswordDirty = false;
         }
     }
 
+    // Each loader reads its file into a scratch arena and parses records from
+    // views into that buffer; the bytes and line table are freed together
+    // when the loader returns. Loading stops at the first malformed record.
     void loadHRPassword() {
+        hrPasswordLoaded = true;
         ifstream in(HR_FILE);
         if (in.is_open()) {
             getline(in, hrPassword);
@@ -638,69 +2510,208 @@ public:
                 emp.saveToFile(out);
             }
             out.close();
+            employeesDirty = false;
         }
     }
 
     void loadEmployees() {
-        ifstream in(EMPLOYEE_FILE);
-        if (in.is_open()) {
+        employeesLoaded = true;
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (RecordParser::readLines(EMPLOYEE_FILE, scratch.resource(), lines)) {
             employees.clear();
+            employeeRowById.clear();
+            employeeNameIndex.clear();
+            employeeEmailCounts.clear();
+            employeePhoneCounts.clear();
+            employeeIdSet.clear();
+            departmentIndex.clear();
+            positionIndex.clear();
+            salaryColumn.clear();
+            employees.reserve(lines.size());
+            salaryColumn.reserve(lines.size());
             Employee emp;
-            while (emp.loadFromFile(in)) {
+            for (string_view line : lines) {
+                if (!emp.loadFromLine(line)) break;
+                employeeRowById.emplace(emp.getId(), employees.size());
                 employees.push_back(emp);
+                salaryColumn.add(emp.getId(), emp.getSalary());
+                indexEmployeeName(emp);
+                indexEmployeeContact(emp);
+                employeeIdSet.add((uint32_t)emp.getId());
+                departmentIndex.add(emp.getDepartment(), emp.getId(), emp.getSalary());
+                positionIndex.add(emp.getPosition(), emp.getId(), emp.getSalary());
                 if (emp.getId() >= nextEmployeeId) {
                     nextEmployeeId = emp.getId() + 1;
                 }
             }
-            in.close();
+            if (employeeVersionsBuilt) rebuildEmployeeVersions();
         }
     }
 
+    // Records only hold handles into the blob file, so without it open
+    // projects.dat is left as it is
     void saveProjects() {
+        if (!projectBlobs.isOpen()) {
+            cout << "Error: " << PROJECT_BLOB_FILE << " is not open; projects not saved!\n";
+            return;
+        }
         ofstream out(PROJECT_FILE);
         if (out.is_open()) {
             for (const auto& proj : projects) {
                 proj.saveToFile(out);
             }
             out.close();
+            projectsDirty = false;
         }
     }
 
     void loadProjects() {
-        ifstream in(PROJECT_FILE);
-        if (in.is_open()) {
+        projectsLoaded = true;
+        if (!projectBlobs.open(PROJECT_BLOB_FILE)) {
+            cout << "Error: Cannot open " << PROJECT_BLOB_FILE << "; project texts are unavailable!\n";
+        }
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (RecordParser::readLines(PROJECT_FILE, scratch.resource(), lines)) {
             projects.clear();
+            projectRowById.clear();
+            projectRowsByEmployee.clear();
+            projectIndex.clear();
+            projects.reserve(lines.size());
             Project proj;
-            while (proj.loadFromFile(in)) {
+            proj.attachBlobs(&projectBlobs);
+            bool migrated = false;
+            bool complete = true;
+            // Bulk-assigned projects share one description; read it once
+            BlobRef lastDescription;
+            string lastDescriptionText;
+            for (string_view line : lines) {
+                if (!proj.loadFromLine(line, &migrated)) {
+                    complete = false;
+                    break;
+                }
+                projectRowById.emplace(proj.getProjectId(), projects.size());
+                projectRowsByEmployee[proj.getEmployeeId()].push_back(projects.size());
                 projects.push_back(proj);
+                if (!(proj.getDescriptionRef() == lastDescription)) {
+                    lastDescription = proj.getDescriptionRef();
+                    lastDescriptionText = proj.getDescription();
+                }
+                projectIndex.addDocument(proj.getProjectId(), proj.getTitle() + " " + lastDescriptionText + " " +
+                                                              (proj.hasFeedback() ? proj.getFeedback() : ""));
                 if (proj.getProjectId() >= nextProjectId) {
                     nextProjectId = proj.getProjectId() + 1;
                 }
             }
-            in.close();
+            // Rewrite inline records as handles now, so the texts are not
+            // copied into the blob file again on the next start. A partial
+            // load is never written back over the full file.
+            if (migrated && complete) saveProjects();
         }
     }
 
     void saveAttendance() {
         ofstream out(ATTENDANCE_FILE);
         if (out.is_open()) {
-            for (const auto& att : attendanceRecords) {
-                att.saveToFile(out);
+            for (size_t i = 0; i < attendanceStore.size(); i++) {
+                attendanceStore.getRecord(i).saveToFile(out);
             }
             out.close();
+            attendanceDirty = false;
+            attendanceRowsOnDisk = attendanceStore.size();
+        }
+    }
+
+    // The log is append-only, so new rows [firstRow, end) are added to the
+    // end of attendance.dat rather than rewriting it. Falls back to a full
+    // save when the file is not known to hold exactly the earlier rows.
+    void appendAttendanceToFile(size_t firstRow) {
+        if (attendanceDirty || attendanceRowsOnDisk != firstRow) {
+            saveAttendance();
+            return;
+        }
+        bool needsNewline = false;
+        {
+            ifstream in(ATTENDANCE_FILE, ios::binary | ios::ate);
+            if (in.is_open() && in.tellg() > 0) {
+                in.seekg(-1, ios::end);
+                needsNewline = in.get() != '\n';
+            }
+        }
+        ofstream out(ATTENDANCE_FILE, ios::app);
+        if (!out.is_open()) {
+            attendanceDirty = true;
+            return;
         }
+        if (needsNewline) out << "\n";
+        for (size_t i = firstRow; i < attendanceStore.size(); i++) {
+            attendanceStore.getRecord(i).saveToFile(out);
+        }
+        attendanceRowsOnDisk = attendanceStore.size();
     }
 
+    // attendance.dat is the largest file, so its lines are split into chunks
+    // of roughly ATTENDANCE_CHUNK_BYTES that are parsed in parallel, each into
+    // its own arena. The merged columns live in attendanceArena, which a
+    // reload releases in one step. (Rows appended later by markAttendance
+    // grow inside the same arena; the replaced buffers are reclaimed by the
+    // next reload.)
     void loadAttendance() {
-        ifstream in(ATTENDANCE_FILE);
-        if (in.is_open()) {
-            attendanceRecords.clear();
-            Attendance att;
-            while (att.loadFromFile(in)) {
-                attendanceRecords.push_back(att);
+        attendanceLoaded = true;
+        attendanceRowsOnDisk = 0;
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (!RecordParser::readLines(ATTENDANCE_FILE, scratch.resource(), lines)) return;
+
+        vector<pair<size_t, size_t>> ranges; // [first line, last line)
+        size_t first = 0, bytes = 0;
+        for (size_t i = 0; i < lines.size(); i++) {
+            bytes += lines[i].size() + 1;
+            if (bytes >= ATTENDANCE_CHUNK_BYTES || i + 1 == lines.size()) {
+                ranges.push_back({first, i + 1});
+                first = i + 1;
+                bytes = 0;
             }
-            in.close();
         }
+
+        vector<LoadArena> chunkArenas(ranges.size());
+        vector<AttendanceStore> parsed;
+        parsed.reserve(ranges.size());
+        for (auto& arena : chunkArenas) parsed.emplace_back(arena.resource());
+        vector<char> stopped(ranges.size(), 0);
+        vector<function<void()>> tasks;
+        for (size_t c = 0; c < ranges.size(); c++) {
+            tasks.push_back([&lines, &ranges, &parsed, &stopped, c]() {
+                parsed[c].reserve(ranges[c].second - ranges[c].first);
+                for (size_t i = ranges[c].first; i < ranges[c].second; i++) {
+                    if (!parsed[c].appendLine(lines[i])) {
+                        stopped[c] = 1;
+                        break;
+                    }
+                }
+            });
+        }
+        TaskPool().run(tasks);
+
+        // Like the sequential loader, stop at the first malformed line
+        attendanceStore.release();
+        attendanceArena.reset();
+        size_t total = 0;
+        for (const auto& chunk : parsed) total += chunk.size();
+        attendanceStore.reserve(total);
+        bool complete = true;
+        for (size_t c = 0; c < parsed.size(); c++) {
+            attendanceStore.appendAll(parsed[c]);
+            if (stopped[c]) {
+                complete = false;
+                break;
+            }
+        }
+        attendanceCalendar.rebuild(attendanceStore);
+        if (attendanceVersionsBuilt) rebuildAttendanceVersions();
+        // A malformed tail stays in the file until the next full save
+        if (complete) attendanceRowsOnDisk = attendanceStore.size();
     }
 
     void saveNotices() {
@@ -710,21 +2721,63 @@ public:
                 notice.saveToFile(out);
             }
             out.close();
+            noticesDirty = false;
         }
     }
 
     void loadNotices() {
-        ifstream in(NOTICE_FILE);
-        if (in.is_open()) {
+        noticesLoaded = true;
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (RecordParser::readLines(NOTICE_FILE, scratch.resource(), lines)) {
             notices.clear();
+            noticeIndex.clear();
+            notices.reserve(lines.size());
             Notice notice;
-            while (notice.loadFromFile(in)) {
+            for (string_view line : lines) {
+                if (!notice.loadFromLine(line)) break;
                 notices.push_back(notice);
+                noticeIndex.addDocument(notice.getNoticeId(), noticeSearchText(notice));
                 if (notice.getNoticeId() >= nextNoticeId) {
                     nextNoticeId = notice.getNoticeId() + 1;
                 }
             }
-            in.close();
+            // Paging and lookups rely on ID order; only a hand-edited file breaks it
+            auto byId = [](const Notice& a, const Notice& b) { return a.getNoticeId() < b.getNoticeId(); };
+            if (!is_sorted(notices.begin(), notices.end(), byId)) {
+                stable_sort(notices.begin(), notices.end(), byId);
+            }
+            rebuildNoticeFeed();
+        }
+        loadNoticeReads();
+    }
+
+    // One line per notice: noticeId|reader runs (see RoaringBitmap)
+    void saveNoticeReads() {
+        ofstream out(NOTICE_READS_FILE);
+        if (out.is_open()) {
+            for (const auto& notice : notices) {
+                auto it = noticeReads.find(notice.getNoticeId());
+                if (it == noticeReads.end() || it->second.empty()) continue;
+                out << notice.getNoticeId() << "|" << it->second.toRunString() << "\n";
+            }
+            out.close();
+            noticeReadsDirty = false;
+        }
+    }
+
+    void loadNoticeReads() {
+        noticeReads.clear();
+        noticesReadCount.clear();
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (!RecordParser::readLines(NOTICE_READS_FILE, scratch.resource(), lines)) return;
+        string_view f[2];
+        for (string_view line : lines) {
+            int noticeId;
+            if (RecordParser::splitFields(line, f, 2) < 2 || !RecordParser::parseInt(f[0], noticeId)) break;
+            if (!findNoticeById(noticeId)) continue; // archived since
+            if (!noticeReads[noticeId].addRuns(f[1])) break;
         }
     }
 
@@ -735,21 +2788,29 @@ public:
                 candidate.saveToFile(out);
             }
             out.close();
+            candidatesDirty = false;
         }
     }
 
     void loadCandidates() {
-        ifstream in(CANDIDATE_FILE);
-        if (in.is_open()) {
+        candidatesLoaded = true;
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (RecordParser::readLines(CANDIDATE_FILE, scratch.resource(), lines)) {
             candidates.clear();
+            candidateEmailIndex.clear();
+            recruitmentFunnel.clear();
+            candidates.reserve(lines.size());
             Candidate candidate;
-            while (candidate.loadFromFile(in)) {
+            for (string_view line : lines) {
+                if (!candidate.loadFromLine(line)) break;
                 candidates.push_back(candidate);
+                candidateEmailIndex.emplace(normalizeEmail(candidate.getEmail()), candidate.getCandidateId());
+                recruitmentFunnel.add(candidate.getPositionSymbol(), candidate.getStatusSymbol());
                 if (candidate.getCandidateId() >= nextCandidateId) {
                     nextCandidateId = candidate.getCandidateId() + 1;
                 }
             }
-            in.close();
         }
     }
 
@@ -760,21 +2821,29 @@ public:
                 leave.saveToFile(out);
             }
             out.close();
+            leaveRequestsDirty = false;
         }
     }
 
     void loadLeaveRequests() {
-        ifstream in(LEAVE_FILE);
-        if (in.is_open()) {
+        leaveRequestsLoaded = true;
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (RecordParser::readLines(LEAVE_FILE, scratch.resource(), lines)) {
             leaveRequests.clear();
+            leaveRowById.clear();
+            leaveCalendar.clear();
+            leaveRequests.reserve(lines.size());
             LeaveRequest leave;
-            while (leave.loadFromFile(in)) {
+            for (string_view line : lines) {
+                if (!leave.loadFromLine(line)) break;
+                leaveRowById.emplace(leave.getRequestId(), leaveRequests.size());
                 leaveRequests.push_back(leave);
+                indexLeave(leave);
                 if (leave.getRequestId() >= nextLeaveRequestId) {
                     nextLeaveRequestId = leave.getRequestId() + 1;
                 }
             }
-            in.close();
         }
     }
 
@@ -785,18 +2854,23 @@ public:
                 entry.second.saveToFile(out);
             }
             out.close();
+            performanceDirty = false;
         }
     }
 
     void loadPerformance() {
-        ifstream in(PERFORMANCE_FILE);
-        if (in.is_open()) {
+        performanceLoaded = true;
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (RecordParser::readLines(PERFORMANCE_FILE, scratch.resource(), lines)) {
             performanceMap.clear();
+            leaderboard.clear();
             Performance perf;
-            while (perf.loadFromFile(in)) {
+            for (string_view line : lines) {
+                if (!perf.loadFromLine(line)) break;
                 performanceMap[perf.getEmployeeId()] = perf;
+                leaderboard.update(perf.getEmployeeId(), perf.getPerformanceScore());
             }
-            in.close();
         }
     }
 };
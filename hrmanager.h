@@ -58,27 +58,22 @@ public:
     bool loadFromFile(ifstream& in) {
         string line;
         if (getline(in, line)) {
-            size_t pos = 0;
-            string delimiter = "|";
-            vector<string> tokens;
-            while ((pos = line.find(delimiter)) != string::npos) {
-                tokens.push_back(line.substr(0, pos));
-                line.erase(0, pos + delimiter.length());
-            }
-            tokens.push_back(line);
-
-            if (tokens.size() >= 6) {
-                id = stoi(tokens[0]);
-                name = tokens[1];
-                email = tokens[2];
-                phone = tokens[3];
-                password = tokens[4];
-                designation = tokens[5];
-                return true;
-            }
+            return loadFromLine(line);
         }
         return false;
     }
+
+    bool loadFromLine(string_view line) {
+        string_view f[6];
+        if (RecordParser::splitFields(line, f, 6) < 6) return false;
+        if (!RecordParser::parseInt(f[0], id)) return false;
+        name.assign(f[1]);
+        email.assign(f[2]);
+        phone.assign(f[3]);
+        password.assign(f[4]);
+        designation.assign(f[5]);
+        return true;
+    }
 };
 
 // Notice class
@@ -88,7 +83,7 @@ private:
     string title;
     string content;
     string date;
-    string type; // "General", "Recruitment", "Urgent"
+    Symbol type; // "General", "Recruitment", "Urgent"
 
 public:
     Notice() : noticeId(0), title(""), content(""), date(""), type("General") {}
@@ -101,7 +96,8 @@ public:
     string getTitle() const { return title; }
     string getContent() const { return content; }
     string getDate() const { return date; }
-    string getType() const { return type; }
+    string getType() const { return type.str(); }
+    Symbol getTypeSymbol() const { return type; }
 
     void display() const {
         cout << "\n========== NOTICE ==========\n";
@@ -120,26 +116,21 @@ public:
     bool loadFromFile(ifstream& in) {
         string line;
         if (getline(in, line)) {
-            size_t pos = 0;
-            string delimiter = "|";
-            vector<string> tokens;
-            while ((pos = line.find(delimiter)) != string::npos) {
-                tokens.push_back(line.substr(0, pos));
-                line.erase(0, pos + delimiter.length());
-            }
-            tokens.push_back(line);
-
-            if (tokens.size() >= 5) {
-                noticeId = stoi(tokens[0]);
-                title = tokens[1];
-                content = tokens[2];
-                date = tokens[3];
-                type = tokens[4];
-                return true;
-            }
+            return loadFromLine(line);
         }
         return false;
     }
+
+    bool loadFromLine(string_view line) {
+        string_view f[5];
+        if (RecordParser::splitFields(line, f, 5) < 5) return false;
+        if (!RecordParser::parseInt(f[0], noticeId)) return false;
+        title.assign(f[1]);
+        content.assign(f[2]);
+        date.assign(f[3]);
+        type = f[4];
+        return true;
+    }
 };
 
 // Candidate class for recruitment
@@ -149,8 +140,8 @@ private:
     string name;
     string email;
     string phone;
-    string position;
-    string status; // "Applied", "Interview Scheduled", "Selected", "Rejected"
+    Symbol position;
+    Symbol status; // "Applied", "Interview Scheduled", "Selected", "Rejected"
     string appliedDate;
     string interviewDate;
 
@@ -191,12 +182,14 @@ public:
     string getName() const { return name; }
     string getEmail() const { return email; }
     string getPhone() const { return phone; }
-    string getPosition() const { return position; }
-    string getStatus() const { return status; }
+    string getPosition() const { return position.str(); }
+    string getStatus() const { return status.str(); }
+    Symbol getPositionSymbol() const { return position; }
+    Symbol getStatusSymbol() const { return status; }
     string getAppliedDate() const { return appliedDate; }
     string getInterviewDate() const { return interviewDate; }
 
-    void setStatus(string s) { status = s; }
+    void setStatus(Symbol s) { status = s; }
     void setInterviewDate(string d) { interviewDate = d; }
 
     void display() const {
@@ -223,29 +216,24 @@ public:
     bool loadFromFile(ifstream& in) {
         string line;
         if (getline(in, line)) {
-            size_t pos = 0;
-            string delimiter = "|";
-            vector<string> tokens;
-            while ((pos = line.find(delimiter)) != string::npos) {
-                tokens.push_back(line.substr(0, pos));
-                line.erase(0, pos + delimiter.length());
-            }
-            tokens.push_back(line);
-
-            if (tokens.size() >= 8) {
-                candidateId = stoi(tokens[0]);
-                name = tokens[1];
-                email = tokens[2];
-                phone = tokens[3];
-                position = tokens[4];
-                status = tokens[5];
-                appliedDate = tokens[6];
-                interviewDate = tokens[7];
-                return true;
-            }
+            return loadFromLine(line);
         }
         return false;
     }
+
+    bool loadFromLine(string_view line) {
+        string_view f[8];
+        if (RecordParser::splitFields(line, f, 8) < 8) return false;
+        if (!RecordParser::parseInt(f[0], candidateId)) return false;
+        name.assign(f[1]);
+        email.assign(f[2]);
+        phone.assign(f[3]);
+        position = f[4];
+        status = f[5];
+        appliedDate.assign(f[6]);
+        interviewDate.assign(f[7]);
+        return true;
+    }
 };
 
 // Leave Request class
@@ -253,11 +241,11 @@ class LeaveRequest {
 private:
     int requestId;
     int employeeId;
-    string employeeName;
+    Symbol employeeName;
     string startDate;
     string endDate;
     string reason;
-    string status; // "Pending", "Approved", "Rejected"
+    Symbol status; // "Pending", "Approved", "Rejected"
     string requestDate;
 
 public:
@@ -270,14 +258,15 @@ public:
 
     int getRequestId() const { return requestId; }
     int getEmployeeId() const { return employeeId; }
-    string getEmployeeName() const { return employeeName; }
+    string getEmployeeName() const { return employeeName.str(); }
     string getStartDate() const { return startDate; }
     string getEndDate() const { return endDate; }
     string getReason() const { return reason; }
-    string getStatus() const { return status; }
+    string getStatus() const { return status.str(); }
+    Symbol getStatusSymbol() const { return status; }
     string getRequestDate() const { return requestDate; }
 
-    void setStatus(string s) { status = s; }
+    void setStatus(Symbol s) { status = s; }
 
     void display() const {
         cout << "\n========== LEAVE REQUEST ==========\n";
@@ -299,29 +288,23 @@ public:
     bool loadFromFile(ifstream& in) {
         string line;
         if (getline(in, line)) {
-            size_t pos = 0;
-            string delimiter = "|";
-            vector<string> tokens;
-            while ((pos = line.find(delimiter)) != string::npos) {
-                tokens.push_back(line.substr(0, pos));
-                line.erase(0, pos + delimiter.length());
-            }
-            tokens.push_back(line);
-
-            if (tokens.size() >= 8) {
-                requestId = stoi(tokens[0]);
-                employeeId = stoi(tokens[1]);
-                employeeName = tokens[2];
-                startDate = tokens[3];
-                endDate = tokens[4];
-                reason = tokens[5];
-                status = tokens[6];
-                requestDate = tokens[7];
-                return true;
-            }
+            return loadFromLine(line);
         }
         return false;
     }
+
+    bool loadFromLine(string_view line) {
+        string_view f[8];
+        if (RecordParser::splitFields(line, f, 8) < 8) return false;
+        if (!RecordParser::parseInt(f[0], requestId) || !RecordParser::parseInt(f[1], employeeId)) return false;
+        employeeName = f[2];
+        startDate.assign(f[3]);
+        endDate.assign(f[4]);
+        reason.assign(f[5]);
+        status = f[6];
+        requestDate.assign(f[7]);
+        return true;
+    }
 };
 
 // Template class for generic data storage
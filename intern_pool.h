@@ -0,0 +1,103 @@
+#ifndef INTERN_POOL_H
+#define INTERN_POOL_H
+
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
+#include <cstdint>
+#include <ostream>
+using namespace std;
+
+// Process-wide string intern pool. Repetitive record fields (department,
+// position, status, type, copied employee names) are stored once here and
+// referred to by a 32-bit ID. Thread-safe, since the parallel loaders
+// intern concurrently.
+class InternPool {
+private:
+    deque<string> strings; // deque: references stay valid as it grows
+    unordered_map<string_view, uint32_t> ids; // keys view into strings
+    mutable shared_mutex lock;
+
+    InternPool() {
+        strings.push_back(""); // ID 0 is always the empty string
+        ids[strings.back()] = 0;
+    }
+
+public:
+    InternPool(const InternPool&) = delete;
+    InternPool& operator=(const InternPool&) = delete;
+
+    static InternPool& instance() {
+        static InternPool pool;
+        return pool;
+    }
+
+    uint32_t intern(string_view s) {
+        if (s.empty()) return 0;
+        {
+            shared_lock<shared_mutex> read(lock);
+            auto it = ids.find(s);
+            if (it != ids.end()) return it->second;
+        }
+        unique_lock<shared_mutex> write(lock);
+        auto it = ids.find(s);
+        if (it != ids.end()) return it->second;
+        uint32_t id = (uint32_t)strings.size();
+        strings.emplace_back(s);
+        ids[strings.back()] = id;
+        return id;
+    }
+
+    // Lookup without inserting; false if nothing has interned s yet
+    bool find(string_view s, uint32_t& id) const {
+        shared_lock<shared_mutex> read(lock);
+        auto it = ids.find(s);
+        if (it == ids.end()) return false;
+        id = it->second;
+        return true;
+    }
+
+    const string& resolve(uint32_t id) const {
+        shared_lock<shared_mutex> read(lock);
+        return strings[id];
+    }
+
+    size_t size() const {
+        shared_lock<shared_mutex> read(lock);
+        return strings.size();
+    }
+};
+
+// Interned string value: four bytes in the record, integer equality, and the
+// text resolved only when it is displayed or saved.
+class Symbol {
+private:
+    uint32_t id;
+
+public:
+    Symbol() : id(0) {}
+    Symbol(const string& s) : id(InternPool::instance().intern(s)) {}
+    Symbol(const char* s) : id(InternPool::instance().intern(s)) {}
+    Symbol(string_view s) : id(InternPool::instance().intern(s)) {}
+
+    // The existing symbol for s, leaving the pool unchanged if there is none
+    static bool find(string_view s, Symbol& out) {
+        return InternPool::instance().find(s, out.id);
+    }
+
+    const string& str() const { return InternPool::instance().resolve(id); }
+    uint32_t getId() const { return id; }
+    bool empty() const { return id == 0; }
+
+    bool operator==(const Symbol& other) const { return id == other.id; }
+    bool operator!=(const Symbol& other) const { return id != other.id; }
+};
+
+inline ostream& operator<<(ostream& out, const Symbol& s) {
+    return out << s.str();
+}
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef INTERVAL_TREE_H
+#define INTERVAL_TREE_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+using namespace std;
+
+// One indexed leave: closed day-number range plus who/which request it is.
+struct LeaveInterval {
+    int startDay;
+    int endDay;
+    int requestId;
+    int employeeId;
+};
+
+// Interval index over leave ranges: a treap ordered by (startDay, requestId)
+// where every node also carries the largest endDay in its subtree. Subtrees
+// whose max end is before the query, or that start after it, are skipped,
+// so stabbing and overlap queries only visit paths leading to matches.
+// Nodes live in one vector (freed slots are reused) rather than one heap
+// allocation each.
+class IntervalTree {
+private:
+    struct Node {
+        LeaveInterval interval;
+        int maxEnd;
+        uint32_t priority;
+        int left;
+        int right;
+    };
+
+    vector<Node> nodes;
+    vector<int> freeSlots;
+    int root;
+    size_t count;
+    uint32_t seed;
+
+    uint32_t nextPriority() {
+        // xorshift32; only needs to be well spread, not secure
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    }
+
+    static bool keyLess(const LeaveInterval& a, int startDay, int requestId) {
+        return a.startDay < startDay || (a.startDay == startDay && a.requestId < requestId);
+    }
+
+    void pull(int t) {
+        Node& n = nodes[t];
+        n.maxEnd = n.interval.endDay;
+        if (n.left != -1) n.maxEnd = max(n.maxEnd, nodes[n.left].maxEnd);
+        if (n.right != -1) n.maxEnd = max(n.maxEnd, nodes[n.right].maxEnd);
+    }
+
+    // Splits t into keys before (startDay, requestId) and the rest; with
+    // inclusive set, the key itself also goes left.
+    void split(int t, int startDay, int requestId, bool inclusive, int& l, int& r) {
+        if (t == -1) { l = r = -1; return; }
+        const LeaveInterval& iv = nodes[t].interval;
+        bool goesLeft = keyLess(iv, startDay, requestId) ||
+                        (inclusive && iv.startDay == startDay && iv.requestId == requestId);
+        if (goesLeft) {
+            split(nodes[t].right, startDay, requestId, inclusive, nodes[t].right, r);
+            l = t;
+        } else {
+            split(nodes[t].left, startDay, requestId, inclusive, l, nodes[t].left);
+            r = t;
+        }
+        pull(t);
+    }
+
+    int merge(int l, int r) {
+        if (l == -1) return r;
+        if (r == -1) return l;
+        if (nodes[l].priority > nodes[r].priority) {
+            nodes[l].right = merge(nodes[l].right, r);
+            pull(l);
+            return l;
+        }
+        nodes[r].left = merge(l, nodes[r].left);
+        pull(r);
+        return r;
+    }
+
+    void collect(int t, int fromDay, int toDay, vector<LeaveInterval>& out) const {
+        if (t == -1 || nodes[t].maxEnd < fromDay) return;
+        const Node& n = nodes[t];
+        collect(n.left, fromDay, toDay, out);
+        if (n.interval.startDay > toDay) return; // so does everything to the right
+        if (n.interval.endDay >= fromDay) out.push_back(n.interval);
+        collect(n.right, fromDay, toDay, out);
+    }
+
+public:
+    IntervalTree() : root(-1), count(0), seed(2463534242u) {}
+
+    void insert(const LeaveInterval& interval) {
+        int slot;
+        if (!freeSlots.empty()) {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slot = (int)nodes.size();
+            nodes.push_back(Node());
+        }
+        Node& n = nodes[slot];
+        n.interval = interval;
+        n.maxEnd = interval.endDay;
+        n.priority = nextPriority();
+        n.left = n.right = -1;
+
+        int l, r;
+        split(root, interval.startDay, interval.requestId, false, l, r);
+        root = merge(merge(l, slot), r);
+        count++;
+    }
+
+    // Removes the interval with this start day and request ID, if present.
+    bool remove(int startDay, int requestId) {
+        int l, mid, r;
+        split(root, startDay, requestId, false, l, r);
+        split(r, startDay, requestId, true, mid, r);
+        root = merge(l, r);
+        if (mid == -1) return false;
+        freeSlots.push_back(mid);
+        count--;
+        return true;
+    }
+
+    void clear() {
+        nodes.clear();
+        freeSlots.clear();
+        root = -1;
+        count = 0;
+    }
+
+    size_t size() const { return count; }
+
+    // Every interval containing day, ordered by start day.
+    vector<LeaveInterval> stab(int day) const {
+        return overlapping(day, day);
+    }
+
+    // Every interval sharing at least one day with [fromDay, toDay].
+    vector<LeaveInterval> overlapping(int fromDay, int toDay) const {
+        vector<LeaveInterval> out;
+        if (fromDay <= toDay) collect(root, fromDay, toDay, out);
+        return out;
+    }
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <functional>
+#include <ext/pb_ds/assoc_container.hpp>
+#include <ext/pb_ds/tree_policy.hpp>
+using namespace std;
+
+// Performance ranking kept up to date as scores change. An order-statistics
+// tree keyed by (-score, employeeId) gives rank lookups, top-K and rank
+// ranges in O(log n + k) without re-sorting. Ties rank by employee ID.
+class Leaderboard {
+private:
+    typedef pair<double, int> Key; // (-score, employeeId)
+    typedef __gnu_pbds::tree<Key, __gnu_pbds::null_type, less<Key>, __gnu_pbds::rb_tree_tag,
+                             __gnu_pbds::tree_order_statistics_node_update> RankTree;
+
+    RankTree ranking;
+    unordered_map<int, double> scores; // current score of every ranked employee
+
+public:
+    Leaderboard() {}
+
+    void update(int empId, double score) {
+        auto it = scores.find(empId);
+        if (it != scores.end()) {
+            if (it->second == score) return;
+            ranking.erase(Key(-it->second, empId));
+            it->second = score;
+        } else {
+            scores[empId] = score;
+        }
+        ranking.insert(Key(-score, empId));
+    }
+
+    void remove(int empId) {
+        auto it = scores.find(empId);
+        if (it == scores.end()) return;
+        ranking.erase(Key(-it->second, empId));
+        scores.erase(it);
+    }
+
+    void clear() {
+        ranking.clear();
+        scores.clear();
+    }
+
+    size_t size() const { return scores.size(); }
+
+    // 1-based rank, or 0 if the employee has no score yet
+    size_t rankOf(int empId) const {
+        auto it = scores.find(empId);
+        if (it == scores.end()) return 0;
+        return ranking.order_of_key(Key(-it->second, empId)) + 1;
+    }
+
+    bool getScore(int empId, double& score) const {
+        auto it = scores.find(empId);
+        if (it == scores.end()) return false;
+        score = it->second;
+        return true;
+    }
+
+    // (employeeId, score) for ranks fromRank..toRank inclusive, clamped to
+    // the board.
+    vector<pair<int, double>> range(size_t fromRank, size_t toRank) const {
+        vector<pair<int, double>> out;
+        if (fromRank < 1) fromRank = 1;
+        if (toRank > size()) toRank = size();
+        if (fromRank > toRank) return out;
+        out.reserve(toRank - fromRank + 1);
+        auto it = ranking.find_by_order(fromRank - 1);
+        for (size_t rank = fromRank; rank <= toRank && it != ranking.end(); rank++, ++it) {
+            out.push_back({it->second, -it->first});
+        }
+        return out;
+    }
+
+    vector<pair<int, double>> top(size_t k) const { return range(1, k); }
+};
+
+#endif
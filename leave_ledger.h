@@ -0,0 +1,116 @@
+#ifndef LEAVE_LEDGER_H
+#define LEAVE_LEDGER_H
+
+#include "date_utils.h"
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+using namespace std;
+
+// Leave position of one employee on a given day.
+struct LeaveBalance {
+    double accrued; // days earned so far
+    int used;       // approved leave days on or before the date
+    LeaveBalance() : accrued(0), used(0) {}
+    double remaining() const { return accrued - used; }
+};
+
+// Per-employee leave ledger. Leave accrues at a flat rate at the start of
+// every month from the joining month, so accruals are a closed formula.
+// Approved leave is kept as month buckets holding a running (prefix) total
+// of days used, so "balance as of D" is one binary search plus the few
+// leave spans inside D's own month.
+class LeaveLedger {
+private:
+    struct MonthBucket {
+        int month;                   // year * 12 + (month - 1)
+        int cumulativeDays;          // leave days used up to the end of this month
+        vector<pair<int, int>> spans; // [first, last] day numbers inside the month
+    };
+
+    struct Account {
+        int accrualStartMonth; // -1 if the joining date is unknown
+        vector<MonthBucket> buckets; // sorted by month
+        Account() : accrualStartMonth(-1) {}
+    };
+
+    unordered_map<int, Account> accounts;
+    double daysPerMonth;
+
+    static int monthOf(int dayNumber) {
+        int y, m, d;
+        DateUtils::civilFromDays(dayNumber, y, m, d);
+        return y * 12 + (m - 1);
+    }
+
+    static int firstDayOfMonth(int month) {
+        return DateUtils::daysFromCivil(month / 12, month % 12 + 1, 1);
+    }
+
+    void addSpan(Account& account, int month, int firstDay, int lastDay) {
+        auto it = lower_bound(account.buckets.begin(), account.buckets.end(), month,
+                              [](const MonthBucket& b, int m) { return b.month < m; });
+        if (it == account.buckets.end() || it->month != month) {
+            MonthBucket bucket;
+            bucket.month = month;
+            bucket.cumulativeDays = (it == account.buckets.begin()) ? 0 : prev(it)->cumulativeDays;
+            it = account.buckets.insert(it, bucket);
+        }
+        it->spans.push_back({firstDay, lastDay});
+        int days = lastDay - firstDay + 1;
+        for (; it != account.buckets.end(); ++it) it->cumulativeDays += days;
+    }
+
+public:
+    explicit LeaveLedger(double accrualPerMonth) : daysPerMonth(accrualPerMonth) {}
+
+    void clear() { accounts.clear(); }
+
+    // Accrual begins with the month containing joiningDay.
+    void openAccount(int empId, int joiningDay) {
+        accounts[empId].accrualStartMonth = monthOf(joiningDay);
+    }
+
+    // Records approved leave [fromDay, toDay], split at month boundaries.
+    void debit(int empId, int fromDay, int toDay) {
+        Account& account = accounts[empId];
+        int day = fromDay;
+        while (day <= toDay) {
+            int month = monthOf(day);
+            int monthEnd = firstDayOfMonth(month + 1) - 1;
+            int last = min(toDay, monthEnd);
+            addSpan(account, month, day, last);
+            day = last + 1;
+        }
+    }
+
+    LeaveBalance balanceAsOf(int empId, int dayNumber) const {
+        LeaveBalance balance;
+        auto found = accounts.find(empId);
+        if (found == accounts.end()) return balance;
+        const Account& account = found->second;
+        int month = monthOf(dayNumber);
+
+        if (account.accrualStartMonth >= 0 && month >= account.accrualStartMonth) {
+            balance.accrued = (month - account.accrualStartMonth + 1) * daysPerMonth;
+        }
+
+        // Last bucket at or before this month
+        auto it = upper_bound(account.buckets.begin(), account.buckets.end(), month,
+                              [](int m, const MonthBucket& b) { return m < b.month; });
+        if (it == account.buckets.begin()) return balance;
+        --it;
+        if (it->month < month) {
+            balance.used = it->cumulativeDays;
+            return balance;
+        }
+        // Same month: everything before it, plus this month's days up to the date
+        balance.used = (it == account.buckets.begin()) ? 0 : prev(it)->cumulativeDays;
+        for (const auto& span : it->spans) {
+            if (span.first <= dayNumber) balance.used += min(span.second, dayNumber) - span.first + 1;
+        }
+        return balance;
+    }
+};
+
+#endif
@@ -0,0 +1,340 @@
+#ifndef MAIL_QUEUE_H
+#define MAIL_QUEUE_H
+
+#include "smtp_client.h"
+#include "record_parser.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <algorithm>
+using namespace std;
+
+// Relay settings, read from a key=value file (see MailQueue::start):
+//   host, port, from, helo, batch_size, timeout_seconds,
+//   retry_base_seconds, retry_max_seconds, max_attempts
+struct MailRelayConfig {
+    string host;
+    int port;
+    string from;
+    string helo;
+    size_t batchSize;       // messages per SMTP connection
+    int timeoutSeconds;     // per connect / reply
+    int retryBaseSeconds;   // first retry delay; doubles per attempt
+    int retryMaxSeconds;    // cap on the retry delay
+    int maxAttempts;        // then the message is given up on
+
+    MailRelayConfig()
+        : host("127.0.0.1"), port(2525), from("hr-system@localhost"), helo("localhost"),
+          batchSize(50), timeoutSeconds(10), retryBaseSeconds(30), retryMaxSeconds(3600),
+          maxAttempts(8) {}
+};
+
+struct MailMessage {
+    int id;
+    int attempts;
+    long long nextAttemptAt; // epoch seconds
+    string to;
+    string subject;
+    string body;
+    string lastError;
+    MailMessage() : id(0), attempts(0), nextAttemptAt(0) {}
+};
+
+struct MailQueueStats {
+    size_t depth;        // waiting, including any batch being sent
+    size_t inFlight;
+    long long enqueued;  // counters are for this run
+    long long sent;
+    long long failed;
+    long long retries;
+    long long batches;
+    double sendSeconds;  // time spent inside SMTP sessions
+    string lastError;
+    MailQueueStats() : depth(0), inFlight(0), enqueued(0), sent(0), failed(0), retries(0),
+                       batches(0), sendSeconds(0) {}
+};
+
+// Persistent outbound mail queue. enqueue() only appends to the queue file
+// and returns; a background sender picks up due messages in batches, sends
+// each batch over one SMTP connection and rewrites the queue file with what
+// is left. Temporary failures (4xx, connection problems) are retried with
+// exponential backoff; permanent ones (5xx) and messages that run out of
+// attempts go to the failed file. Delivery is at-least-once: a crash in the
+// middle of a batch resends that batch on the next run.
+class MailQueue {
+private:
+    string queueFile;
+    string failedFile;
+    MailRelayConfig config;
+
+    vector<MailMessage> pending; // by id (enqueue order)
+    int nextId;
+    MailQueueStats stats;
+
+    mutex lock;
+    condition_variable wakeup;  // new mail or shutdown
+    condition_variable drained; // a batch finished
+    thread sender;
+    atomic<bool> stopping;
+    bool started;
+
+    // '|' and line breaks cannot appear raw in a record
+    static string escape(const string& text) {
+        string out;
+        out.reserve(text.size());
+        for (char ch : text) {
+            if (ch == '\\') out += "\\\\";
+            else if (ch == '|') out += "\\p";
+            else if (ch == '\n') out += "\\n";
+            else if (ch == '\r') out += "\\r";
+            else out += ch;
+        }
+        return out;
+    }
+
+    static string unescape(string_view text) {
+        string out;
+        out.reserve(text.size());
+        for (size_t i = 0; i < text.size(); i++) {
+            if (text[i] != '\\' || i + 1 == text.size()) {
+                out += text[i];
+                continue;
+            }
+            char code = text[++i];
+            out += code == 'p' ? '|' : code == 'n' ? '\n' : code == 'r' ? '\r' : code;
+        }
+        return out;
+    }
+
+    static void writeRecord(ofstream& out, const MailMessage& m) {
+        out << m.id << "|" << m.attempts << "|" << m.nextAttemptAt << "|" << escape(m.to) << "|"
+            << escape(m.subject) << "|" << escape(m.body) << "|" << escape(m.lastError) << "\n";
+    }
+
+    static bool readRecord(string_view line, MailMessage& m) {
+        string_view f[7];
+        if (RecordParser::splitFields(line, f, 7) < 7) return false;
+        if (!RecordParser::parseInt(f[0], m.id) || !RecordParser::parseInt(f[1], m.attempts)) return false;
+        string_view when = RecordParser::numberStart(f[2]);
+        if (from_chars(when.data(), when.data() + when.size(), m.nextAttemptAt).ec != errc()) return false;
+        m.to = unescape(f[3]);
+        m.subject = unescape(f[4]);
+        m.body = unescape(f[5]);
+        m.lastError = unescape(f[6]);
+        return true;
+    }
+
+    void loadConfig(const string& path) {
+        ifstream in(path);
+        string line;
+        while (getline(in, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            size_t eq = line.find('=');
+            if (line.empty() || line[0] == '#' || eq == string::npos) continue;
+            string key = line.substr(0, eq);
+            string value = line.substr(eq + 1);
+            int number = atoi(value.c_str());
+            if (key == "host") config.host = value;
+            else if (key == "port" && number > 0) config.port = number;
+            else if (key == "from") config.from = value;
+            else if (key == "helo") config.helo = value;
+            else if (key == "batch_size" && number > 0) config.batchSize = (size_t)number;
+            else if (key == "timeout_seconds" && number > 0) config.timeoutSeconds = number;
+            else if (key == "retry_base_seconds" && number >= 0) config.retryBaseSeconds = number;
+            else if (key == "retry_max_seconds" && number >= 0) config.retryMaxSeconds = number;
+            else if (key == "max_attempts" && number > 0) config.maxAttempts = number;
+        }
+    }
+
+    void loadQueue() {
+        LoadArena scratch;
+        pmr::vector<string_view> lines(scratch.resource());
+        if (!RecordParser::readLines(queueFile, scratch.resource(), lines)) return;
+        MailMessage m;
+        for (string_view line : lines) {
+            if (!readRecord(line, m)) break;
+            pending.push_back(m);
+            nextId = max(nextId, m.id + 1);
+        }
+    }
+
+    // Caller holds lock
+    void saveQueue() {
+        ofstream out(queueFile);
+        for (const auto& m : pending) writeRecord(out, m);
+    }
+
+    void recordFailure(const MailMessage& m) {
+        ofstream out(failedFile, ios::app);
+        writeRecord(out, m);
+        stats.failed++;
+        stats.lastError = m.lastError;
+    }
+
+    long long retryDelay(int attempts) const {
+        long long delay = config.retryBaseSeconds;
+        for (int i = 1; i < attempts && delay < config.retryMaxSeconds; i++) delay *= 2;
+        return min(delay, (long long)config.retryMaxSeconds);
+    }
+
+    struct Outcome {
+        int code;
+        string reply;
+    };
+
+    // Runs without the lock: one SMTP session for the whole batch
+    vector<Outcome> deliver(const vector<MailMessage>& batch) {
+        vector<Outcome> outcomes(batch.size(), Outcome{-1, ""});
+        SmtpSession session(config.timeoutSeconds, &stopping);
+        if (!session.open(config.host, config.port, config.helo)) {
+            for (auto& o : outcomes) o.reply = session.getLastReply();
+            return outcomes;
+        }
+        for (size_t i = 0; i < batch.size(); i++) {
+            const MailMessage& m = batch[i];
+            string messageId = to_string(m.id) + "." + to_string(time(0)) + "@" + config.helo;
+            outcomes[i].code = session.send(config.from, m.to, m.subject, m.body, messageId);
+            outcomes[i].reply = session.getLastReply();
+            if (!session.isOpen()) {
+                for (size_t j = i + 1; j < batch.size(); j++) outcomes[j].reply = outcomes[i].reply;
+                break;
+            }
+        }
+        session.quit();
+        return outcomes;
+    }
+
+    void run() {
+        unique_lock<mutex> guard(lock);
+        while (!stopping) {
+            long long now = (long long)time(0);
+            long long nextDue = 0;
+            vector<MailMessage> batch;
+            for (const auto& m : pending) {
+                if (m.nextAttemptAt <= now) {
+                    if (batch.size() < config.batchSize) batch.push_back(m);
+                } else if (nextDue == 0 || m.nextAttemptAt < nextDue) {
+                    nextDue = m.nextAttemptAt;
+                }
+            }
+            if (batch.empty()) {
+                if (nextDue == 0) wakeup.wait(guard);
+                else wakeup.wait_until(guard, chrono::system_clock::from_time_t((time_t)nextDue));
+                continue;
+            }
+
+            stats.inFlight = batch.size();
+            guard.unlock();
+            auto began = chrono::steady_clock::now();
+            vector<Outcome> outcomes = deliver(batch);
+            double elapsed = chrono::duration<double>(chrono::steady_clock::now() - began).count();
+            guard.lock();
+
+            stats.inFlight = 0;
+            stats.batches++;
+            stats.sendSeconds += elapsed;
+            now = (long long)time(0);
+            for (size_t i = 0; i < batch.size(); i++) {
+                auto it = find_if(pending.begin(), pending.end(),
+                                  [&](const MailMessage& m) { return m.id == batch[i].id; });
+                if (it == pending.end()) continue;
+                const Outcome& o = outcomes[i];
+                if (o.code == 250) {
+                    stats.sent++;
+                    pending.erase(it);
+                    continue;
+                }
+                it->attempts++;
+                it->lastError = o.code > 0 ? o.reply : "not sent: " + o.reply;
+                if ((o.code >= 500 && o.code < 600) || it->attempts >= config.maxAttempts) {
+                    recordFailure(*it);
+                    pending.erase(it);
+                } else {
+                    it->nextAttemptAt = now + retryDelay(it->attempts);
+                    stats.retries++;
+                    stats.lastError = it->lastError;
+                }
+            }
+            saveQueue();
+            drained.notify_all();
+        }
+    }
+
+public:
+    MailQueue() : nextId(1), stopping(false), started(false) {}
+
+    ~MailQueue() { stop(); }
+
+    // Loads the relay settings and any mail left from earlier runs, then
+    // starts the sender. Later calls do nothing.
+    void start(const string& queuePath, const string& failedPath, const string& configPath) {
+        lock_guard<mutex> guard(lock);
+        if (started) return;
+        started = true;
+        queueFile = queuePath;
+        failedFile = failedPath;
+        loadConfig(configPath);
+        loadQueue();
+        sender = thread(&MailQueue::run, this);
+    }
+
+    // Stops the sender after its current SMTP exchange; unsent mail stays in
+    // the queue file for the next run.
+    void stop() {
+        {
+            lock_guard<mutex> guard(lock);
+            if (!started || stopping) return;
+            stopping = true;
+        }
+        wakeup.notify_all();
+        if (sender.joinable()) sender.join();
+    }
+
+    // Returns the message ID, or 0 if the queue is not running
+    int enqueue(const string& to, const string& subject, const string& body) {
+        lock_guard<mutex> guard(lock);
+        if (!started || stopping) return 0;
+        MailMessage m;
+        m.id = nextId++;
+        m.nextAttemptAt = (long long)time(0);
+        m.to = to;
+        m.subject = subject;
+        // Header text must stay on one line
+        replace(m.subject.begin(), m.subject.end(), '\r', ' ');
+        replace(m.subject.begin(), m.subject.end(), '\n', ' ');
+        m.body = body;
+        pending.push_back(m);
+        ofstream out(queueFile, ios::app);
+        writeRecord(out, m);
+        stats.enqueued++;
+        wakeup.notify_all();
+        return m.id;
+    }
+
+    // Waits up to maxSeconds for the queue to empty; false if mail remains
+    // (typically waiting out a retry delay).
+    bool waitUntilEmpty(int maxSeconds) {
+        unique_lock<mutex> guard(lock);
+        return drained.wait_for(guard, chrono::seconds(maxSeconds), [this]() { return pending.empty(); });
+    }
+
+    MailQueueStats getStats() {
+        lock_guard<mutex> guard(lock);
+        MailQueueStats snapshot = stats;
+        snapshot.depth = pending.size();
+        return snapshot;
+    }
+
+    MailRelayConfig getConfig() {
+        lock_guard<mutex> guard(lock);
+        return config;
+    }
+};
+
+#endif
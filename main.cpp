@@ -44,7 +44,9 @@ void displayHRMenu() {
     cout << "11. Recruitment Management\n";
     cout << "12. Leave Request Management\n";
     cout << "13. Email Project Details\n";
-    cout << "14. Logout\n";
+    cout << "14. Search\n";
+    cout << "15. Reports\n";
+    cout << "16. Logout\n";
     cout << "Enter your choice: ";
 }
 
@@ -58,10 +60,85 @@ void displayEmployeeMenu() {
     cout << "4. View My Performance\n";
     cout << "5. View Notices\n";
     cout << "6. Submit Leave Request\n";
-    cout << "7. Logout\n";
+    cout << "7. View My Rank\n";
+    cout << "8. View My Leave Balance\n";
+    cout << "9. Logout\n";
     cout << "Enter your choice: ";
 }
 
+// "1001, 1002,1005" -> IDs; entries that are not numbers are dropped
+vector<int> parseIdList(const string& text) {
+    vector<int> ids;
+    string item;
+    istringstream in(text);
+    while (getline(in, item, ',')) {
+        int id = atoi(item.c_str());
+        if (id > 0) ids.push_back(id);
+    }
+    return ids;
+}
+
+// "1001:2,1005:4" -> employee ID -> overtime hours
+bool parseOvertimeOverrides(const string& text, unordered_map<int, int>& overrides) {
+    string item;
+    istringstream in(text);
+    while (getline(in, item, ',')) {
+        if (item.find_first_not_of(" \t") == string::npos) continue;
+        size_t colon = item.find(':');
+        if (colon == string::npos) return false;
+        int id = atoi(item.substr(0, colon).c_str());
+        if (id <= 0) return false;
+        overrides[id] = atoi(item.substr(colon + 1).c_str());
+    }
+    return true;
+}
+
+// Batch-mode employee selector: all, dept:NAME, position:NAME or ids:ID,...
+bool resolveEmployeeTargets(HRSystem& system, const string& spec, vector<int>& empIds) {
+    if (spec == "all") {
+        empIds = system.getAllEmployeeIds();
+    } else if (spec.compare(0, 5, "dept:") == 0) {
+        empIds = system.getDepartmentEmployeeIds(spec.substr(5));
+    } else if (spec.compare(0, 9, "position:") == 0) {
+        empIds = system.getPositionEmployeeIds(spec.substr(9));
+    } else if (spec.compare(0, 4, "ids:") == 0) {
+        empIds = parseIdList(spec.substr(4));
+    } else {
+        cout << "Unknown target: " << spec << " (all, dept:NAME, position:NAME or ids:ID,...)\n";
+        return false;
+    }
+    return true;
+}
+
+// Export range/department; blank dates and department mean no filter
+bool buildExportFilter(const string& fromDate, const string& toDate, const string& dept, ExportFilter& filter) {
+    filter.hasFrom = !fromDate.empty();
+    filter.hasTo = !toDate.empty();
+    if ((filter.hasFrom && !DateUtils::parseDate(fromDate, filter.fromDay)) ||
+        (filter.hasTo && !DateUtils::parseDate(toDate, filter.toDay))) {
+        cout << "Error: Dates must be YYYY-MM-DD!\n";
+        return false;
+    }
+    filter.department = dept;
+    return true;
+}
+
+// Newest notices first, one page at a time; pages shown to an employee
+// (readerId) are recorded as read
+void browseNotices(HRSystem& system, int readerId = 0) {
+    string type;
+    cout << "Type (General/Recruitment/Urgent, blank for all): ";
+    getline(cin, type);
+    int cursor = system.displayNoticePage(type, 0, readerId);
+    while (cursor != 0) {
+        string answer;
+        cout << "\nEnter n for older notices, anything else to stop: ";
+        getline(cin, answer);
+        if (answer != "n" && answer != "N") break;
+        cursor = system.displayNoticePage(type, cursor, readerId);
+    }
+}
+
 void hrManagerSession(HRSystem& system) {
     int choice;
     do {
@@ -97,18 +174,50 @@ void hrManagerSession(HRSystem& system) {
             }
 
             case 3: { // Assign Project
-                int empId;
-                string title, description, deadline, projectType;
-
                 cout << "\n=== ASSIGN PROJECT ===\n";
-                cout << "Employee ID: "; cin >> empId;
+                cout << "1. Single Employee\n";
+                cout << "2. Department\n";
+                cout << "3. Position\n";
+                cout << "4. List of Employees\n";
+                cout << "Choice: ";
+                int subChoice;
+                cin >> subChoice;
                 cin.ignore();
+                if (subChoice < 1 || subChoice > 4) {
+                    pauseScreen();
+                    break;
+                }
+
+                int empId = 0;
+                vector<int> empIds;
+                if (subChoice == 1) {
+                    cout << "Employee ID: "; cin >> empId;
+                    cin.ignore();
+                } else if (subChoice == 2) {
+                    string department;
+                    cout << "Department: "; getline(cin, department);
+                    empIds = system.getDepartmentEmployeeIds(department);
+                } else if (subChoice == 3) {
+                    string position;
+                    cout << "Position: "; getline(cin, position);
+                    empIds = system.getPositionEmployeeIds(position);
+                } else {
+                    string list;
+                    cout << "Employee IDs (comma separated): "; getline(cin, list);
+                    empIds = parseIdList(list);
+                }
+
+                string title, description, deadline, projectType;
                 cout << "Project Title: "; getline(cin, title);
                 cout << "Description: "; getline(cin, description);
                 cout << "Deadline (YYYY-MM-DD): "; getline(cin, deadline);
                 cout << "Project Type (Minor/Major/Urgent/Long-term): "; getline(cin, projectType);
 
-                system.assignProject(empId, title, description, deadline, projectType);
+                if (subChoice == 1) {
+                    system.assignProject(empId, title, description, deadline, projectType);
+                } else {
+                    system.assignProjectBulk(empIds, title, description, deadline, projectType);
+                }
                 pauseScreen();
                 break;
             }
@@ -126,6 +235,7 @@ void hrManagerSession(HRSystem& system) {
                 } else {
                     for (const auto& proj : submitted) {
                         proj.display();
+                        cout << "Submission:\n" << proj.getSubmissionContent() << endl;
                         cout << "\nActions:\n";
                         cout << "1. Provide Feedback\n";
                         cout << "2. Accept Project\n";
@@ -150,15 +260,49 @@ void hrManagerSession(HRSystem& system) {
             }
 
             case 6: { // Mark Attendance
-                int empId, overtime;
-                char present;
-
                 cout << "\n=== MARK ATTENDANCE ===\n";
-                cout << "Employee ID: "; cin >> empId;
-                cout << "Present? (y/n): "; cin >> present;
-                cout << "Overtime Hours: "; cin >> overtime;
+                cout << "1. Single Employee\n";
+                cout << "2. Whole Company\n";
+                cout << "3. Department\n";
+                cout << "4. List of Employees\n";
+                cout << "Choice: ";
+                int subChoice;
+                cin >> subChoice;
+                cin.ignore();
 
-                system.markAttendance(empId, (present == 'y' || present == 'Y'), overtime);
+                if (subChoice == 1) {
+                    int empId, overtime;
+                    char present;
+                    cout << "Employee ID: "; cin >> empId;
+                    cout << "Present? (y/n): "; cin >> present;
+                    cout << "Overtime Hours: "; cin >> overtime;
+                    system.markAttendance(empId, (present == 'y' || present == 'Y'), overtime);
+                } else if (subChoice >= 2 && subChoice <= 4) {
+                    vector<int> empIds;
+                    if (subChoice == 2) {
+                        empIds = system.getAllEmployeeIds();
+                    } else if (subChoice == 3) {
+                        string department;
+                        cout << "Department: "; getline(cin, department);
+                        empIds = system.getDepartmentEmployeeIds(department);
+                    } else {
+                        string list;
+                        cout << "Employee IDs (comma separated): "; getline(cin, list);
+                        empIds = parseIdList(list);
+                    }
+                    string date, present, overtime, overrides;
+                    cout << "Date (YYYY-MM-DD, blank for today): "; getline(cin, date);
+                    cout << "Present? (y/n): "; getline(cin, present);
+                    cout << "Overtime Hours (default for everyone): "; getline(cin, overtime);
+                    cout << "Overtime exceptions (id:hours,..., blank for none): "; getline(cin, overrides);
+                    unordered_map<int, int> overtimeOverrides;
+                    if (!parseOvertimeOverrides(overrides, overtimeOverrides)) {
+                        cout << "Invalid overtime exceptions!\n";
+                    } else {
+                        system.markAttendanceBulk(empIds, date, present == "y" || present == "Y",
+                                                  atoi(overtime.c_str()), overtimeOverrides);
+                    }
+                }
                 pauseScreen();
                 break;
             }
@@ -197,7 +341,32 @@ void hrManagerSession(HRSystem& system) {
             }
 
             case 10: { // View Notices
-                system.displayAllNotices();
+                cout << "\n=== NOTICES ===\n";
+                cout << "1. Browse Notices\n";
+                cout << "2. Archive Old Notices\n";
+                cout << "3. Who Hasn't Read a Notice\n";
+                cout << "4. Unread Count for an Employee\n";
+                cout << "Choice: ";
+                int subChoice;
+                cin >> subChoice;
+                cin.ignore();
+
+                if (subChoice == 1) {
+                    browseNotices(system);
+                } else if (subChoice == 2) {
+                    string cutoff;
+                    cout << "Archive notices dated before (YYYY-MM-DD): ";
+                    getline(cin, cutoff);
+                    system.archiveNoticesBefore(cutoff);
+                } else if (subChoice == 3) {
+                    int noticeId;
+                    cout << "Notice ID: "; cin >> noticeId;
+                    system.displayNoticeReadStatus(noticeId);
+                } else if (subChoice == 4) {
+                    int empId;
+                    cout << "Employee ID: "; cin >> empId;
+                    system.displayUnreadCount(empId);
+                }
                 pauseScreen();
                 break;
             }
@@ -207,6 +376,7 @@ void hrManagerSession(HRSystem& system) {
                 cout << "1. Add Candidate\n";
                 cout << "2. View All Candidates\n";
                 cout << "3. Update Candidate Status\n";
+                cout << "4. Funnel & Conversion Report\n";
                 cout << "Choice: ";
                 int subChoice;
                 cin >> subChoice;
@@ -233,6 +403,8 @@ void hrManagerSession(HRSystem& system) {
                         getline(cin, interviewDate);
                     }
                     system.updateCandidateStatus(candId, status, interviewDate);
+                } else if (subChoice == 4) {
+                    system.displayRecruitmentFunnel();
                 }
                 pauseScreen();
                 break;
@@ -273,7 +445,131 @@ void hrManagerSession(HRSystem& system) {
                 break;
             }
 
-            case 14: { // Logout
+            case 14: { // Search
+                cout << "\n=== SEARCH ===\n";
+                cout << "1. Search Notices & Projects\n";
+                cout << "2. Find Employee by Name/Email\n";
+                cout << "3. Query Employees/Projects\n";
+                cout << "Choice: ";
+                int subChoice;
+                cin >> subChoice;
+                cin.ignore();
+
+                if (subChoice == 1) {
+                    string query;
+                    cout << "Query (AND/OR, prefix with *): ";
+                    getline(cin, query);
+                    system.searchNoticesAndProjects(query);
+                } else if (subChoice == 2) {
+                    string query;
+                    cout << "Name or email (typos allowed): ";
+                    getline(cin, query);
+                    system.displayEmployeeSearch(query);
+                } else if (subChoice == 3) {
+                    cout << "e.g. employees where department = \"Engineering\" and salary > 50000\n";
+                    cout << "     projects where status = Assigned and deadline < 2025-01-01\n";
+                    cout << "Prefix with 'explain' to show the plan.\n";
+                    string query;
+                    cout << "Query: ";
+                    getline(cin, query);
+                    bool explain = query.compare(0, 8, "explain ") == 0;
+                    system.runQuery(explain ? query.substr(8) : query, explain);
+                }
+                pauseScreen();
+                break;
+            }
+
+            case 15: { // Reports
+                cout << "\n=== REPORTS ===\n";
+                cout << "1. Headcount & Payroll by Department\n";
+                cout << "2. Headcount & Payroll by Position\n";
+                cout << "3. Payroll Summary\n";
+                cout << "4. Attendance for Date Range\n";
+                cout << "5. Top Performers\n";
+                cout << "6. Rank of an Employee\n";
+                cout << "7. Employees by Rank Range\n";
+                cout << "8. Who Is on Leave (Date)\n";
+                cout << "9. Department Leave Coverage\n";
+                cout << "10. Leave Balances (All Employees)\n";
+                cout << "11. Mail Queue Status\n";
+                cout << "12. Export Report (CSV / JSON Lines)\n";
+                cout << "13. Snapshot Status\n";
+                cout << "Choice: ";
+                int subChoice;
+                cin >> subChoice;
+                cin.ignore();
+
+                if (subChoice == 1) {
+                    system.displayGroupSummary(true);
+                } else if (subChoice == 2) {
+                    system.displayGroupSummary(false);
+                } else if (subChoice == 3) {
+                    system.displayPayrollSummary();
+                } else if (subChoice == 4) {
+                    int empId;
+                    string fromDate, toDate;
+                    cout << "Employee ID: "; cin >> empId;
+                    cin.ignore();
+                    cout << "From (YYYY-MM-DD): "; getline(cin, fromDate);
+                    cout << "To (YYYY-MM-DD): "; getline(cin, toDate);
+                    system.displayAttendanceForRange(empId, fromDate, toDate);
+                } else if (subChoice == 5) {
+                    int count;
+                    cout << "How many: "; cin >> count;
+                    cin.ignore();
+                    system.displayRankings(1, count > 0 ? (size_t)count : 0);
+                } else if (subChoice == 6) {
+                    int empId;
+                    cout << "Employee ID: "; cin >> empId;
+                    cin.ignore();
+                    system.displayEmployeeRank(empId);
+                } else if (subChoice == 7) {
+                    int fromRank, toRank;
+                    cout << "From Rank: "; cin >> fromRank;
+                    cout << "To Rank: "; cin >> toRank;
+                    cin.ignore();
+                    if (fromRank < 1 || toRank < fromRank) {
+                        cout << "Invalid rank range!\n";
+                    } else {
+                        system.displayRankings(fromRank, toRank);
+                    }
+                } else if (subChoice == 8) {
+                    string date;
+                    cout << "Date (YYYY-MM-DD): "; getline(cin, date);
+                    system.displayWhoIsOut(date);
+                } else if (subChoice == 9) {
+                    string department, fromDate, toDate;
+                    cout << "Department: "; getline(cin, department);
+                    cout << "From (YYYY-MM-DD): "; getline(cin, fromDate);
+                    cout << "To (YYYY-MM-DD): "; getline(cin, toDate);
+                    system.displayDepartmentCoverage(department, fromDate, toDate);
+                } else if (subChoice == 10) {
+                    string date;
+                    cout << "As of (YYYY-MM-DD, blank for today): "; getline(cin, date);
+                    system.displayLeaveBalanceReport(date);
+                } else if (subChoice == 11) {
+                    system.displayMailQueueStatus();
+                } else if (subChoice == 12) {
+                    string report, format, path, fromDate, toDate, dept;
+                    cout << "Report (employees/projects/attendance/performance/year-end): ";
+                    getline(cin, report);
+                    cout << "Format (csv/jsonl): "; getline(cin, format);
+                    cout << "Output file: "; getline(cin, path);
+                    cout << "From date (YYYY-MM-DD, blank for none): "; getline(cin, fromDate);
+                    cout << "To date (YYYY-MM-DD, blank for none): "; getline(cin, toDate);
+                    cout << "Department (blank for all): "; getline(cin, dept);
+                    ExportFilter filter;
+                    if (buildExportFilter(fromDate, toDate, dept, filter)) {
+                        system.exportReport(report, format, path, filter);
+                    }
+                } else if (subChoice == 13) {
+                    system.displaySnapshotStatus();
+                }
+                pauseScreen();
+                break;
+            }
+
+            case 16: { // Logout
                 cout << "\nLogging out...\n";
                 break;
             }
@@ -282,7 +578,7 @@ void hrManagerSession(HRSystem& system) {
                 cout << "\nInvalid choice!\n";
                 pauseScreen();
         }
-    } while (choice != 14);
+    } while (choice != 16);
 }
 
 void employeeSession(HRSystem& system, Employee* employee) {
@@ -342,7 +638,9 @@ void employeeSession(HRSystem& system, Employee* employee) {
             }
 
             case 5: { // View Notices
-                system.displayAllNotices();
+                cout << "\nYou have " << system.getUnreadNoticeCount(employee->getId())
+                     << " unread notice(s).\n";
+                browseNotices(system, employee->getId());
                 pauseScreen();
                 break;
             }
@@ -360,7 +658,19 @@ void employeeSession(HRSystem& system, Employee* employee) {
                 break;
             }
 
-            case 7: { // Logout
+            case 7: { // View Rank
+                system.displayEmployeeRank(employee->getId());
+                pauseScreen();
+                break;
+            }
+
+            case 8: { // Leave Balance
+                system.displayLeaveBalance(employee->getId(), "");
+                pauseScreen();
+                break;
+            }
+
+            case 9: { // Logout
                 cout << "\nLogging out...\n";
                 break;
             }
@@ -369,13 +679,232 @@ void employeeSession(HRSystem& system, Employee* employee) {
                 cout << "\nInvalid choice!\n";
                 pauseScreen();
         }
-    } while (choice != 7);
+    } while (choice != 9);
+}
+
+// Non-interactive mode: reads one command per line from standard input.
+void runBatch(HRSystem& system) {
+    string line;
+    while (getline(cin, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        size_t space = line.find(' ');
+        string command = line.substr(0, space);
+        string arg = (space == string::npos) ? "" : line.substr(space + 1);
+
+        if (command.empty() || command[0] == '#') {
+            continue;
+        } else if (command == "find-employee") {
+            system.displayEmployeeSearch(arg);
+        } else if (command == "set-department" || command == "set-position" ||
+                   command == "set-email" || command == "set-phone") {
+            // <employee id> <new value>
+            size_t sep = arg.find(' ');
+            if (sep == string::npos) {
+                cout << "Usage: " << command << " <employee id> <value>\n";
+                continue;
+            }
+            int empId = atoi(arg.substr(0, sep).c_str());
+            if (command == "set-department") {
+                system.updateEmployeeDepartment(empId, arg.substr(sep + 1));
+            } else if (command == "set-email") {
+                system.updateEmployeeEmail(empId, arg.substr(sep + 1));
+            } else if (command == "set-phone") {
+                system.updateEmployeePhone(empId, arg.substr(sep + 1));
+            } else {
+                system.updateEmployeePosition(empId, arg.substr(sep + 1));
+            }
+        } else if (command == "group-report") {
+            system.displayGroupSummary(arg != "position");
+        } else if (command == "attendance-range") {
+            // <employee id> <from> <to>
+            istringstream args(arg);
+            int empId = 0;
+            string fromDate, toDate;
+            args >> empId >> fromDate >> toDate;
+            system.displayAttendanceForRange(empId, fromDate, toDate);
+        } else if (command == "rank") {
+            system.displayEmployeeRank(atoi(arg.c_str()));
+        } else if (command == "top") {
+            int count = arg.empty() ? 10 : atoi(arg.c_str());
+            system.displayRankings(1, count > 0 ? (size_t)count : 0);
+        } else if (command == "ranks") {
+            // <from rank> <to rank>
+            istringstream args(arg);
+            int fromRank = 0, toRank = 0;
+            args >> fromRank >> toRank;
+            if (fromRank < 1 || toRank < fromRank) {
+                cout << "Usage: ranks <from rank> <to rank>\n";
+                continue;
+            }
+            system.displayRankings(fromRank, toRank);
+        } else if (command == "out-on") {
+            system.displayWhoIsOut(arg);
+        } else if (command == "leave-coverage") {
+            // <from> <to> <department>
+            istringstream args(arg);
+            string fromDate, toDate, department;
+            args >> fromDate >> toDate;
+            getline(args >> ws, department);
+            system.displayDepartmentCoverage(department, fromDate, toDate);
+        } else if (command == "leave-balance") {
+            // <employee id> [as of date]
+            istringstream args(arg);
+            int empId = 0;
+            string asOfDate;
+            args >> empId >> asOfDate;
+            system.displayLeaveBalance(empId, asOfDate);
+        } else if (command == "leave-report") {
+            system.displayLeaveBalanceReport(arg);
+        } else if (command == "funnel") {
+            system.displayRecruitmentFunnel();
+        } else if (command == "candidate-count") {
+            // <status>|<position>
+            size_t bar = arg.find('|');
+            if (bar == string::npos) {
+                cout << "Usage: candidate-count <status>|<position>\n";
+                continue;
+            }
+            cout << system.getCandidateCount(arg.substr(bar + 1), arg.substr(0, bar)) << endl;
+        } else if (command == "notices") {
+            // [before notice id] [type]
+            istringstream args(arg);
+            int beforeId = 0;
+            string type;
+            args >> beforeId;
+            getline(args >> ws, type);
+            int cursor = system.displayNoticePage(type, beforeId);
+            if (cursor != 0) {
+                cout << "More: notices " << cursor << (type.empty() ? "" : " " + type) << endl;
+            }
+        } else if (command == "notice-readers") {
+            system.displayNoticeReadStatus(atoi(arg.c_str()));
+        } else if (command == "unread-count") {
+            system.displayUnreadCount(atoi(arg.c_str()));
+        } else if (command == "archive-notices") {
+            system.archiveNoticesBefore(arg);
+        } else if (command == "bulk-assign") {
+            // <target>|<title>|<description>|<deadline>|<type>
+            vector<string> parts;
+            string part;
+            istringstream args(arg);
+            while (getline(args, part, '|')) parts.push_back(part);
+            if (parts.size() < 5) {
+                cout << "Usage: bulk-assign <target>|<title>|<description>|<deadline>|<type>\n";
+                continue;
+            }
+            vector<int> empIds;
+            if (!resolveEmployeeTargets(system, parts[0], empIds)) continue;
+            system.assignProjectBulk(empIds, parts[1], parts[2], parts[3], parts[4]);
+        } else if (command == "email-project") {
+            // <project id> <recipient email>
+            istringstream args(arg);
+            int projectId = 0;
+            string email;
+            args >> projectId >> email;
+            system.emailProject(projectId, email);
+        } else if (command == "mail-status") {
+            system.displayMailQueueStatus();
+        } else if (command == "mail-flush") {
+            int seconds = arg.empty() ? 0 : atoi(arg.c_str());
+            if (seconds <= 0) seconds = 30;
+            if (!system.flushMailQueue(seconds)) {
+                cout << "Mail still queued after " << seconds << "s (see mail-status).\n";
+            }
+            system.displayMailQueueStatus();
+        } else if (command == "bulk-attendance") {
+            // <target>|<date>|<y/n>[|<overtime>[|<id:hours,...>]]
+            vector<string> parts;
+            string part;
+            istringstream args(arg);
+            while (getline(args, part, '|')) parts.push_back(part);
+            unordered_map<int, int> overtimeOverrides;
+            if (parts.size() < 3 || (parts.size() > 4 && !parseOvertimeOverrides(parts[4], overtimeOverrides))) {
+                cout << "Usage: bulk-attendance <target>|<date>|<y/n>[|<overtime>[|<id:hours,...>]]\n";
+                continue;
+            }
+            vector<int> empIds;
+            if (!resolveEmployeeTargets(system, parts[0], empIds)) continue;
+            int overtime = parts.size() > 3 ? atoi(parts[3].c_str()) : 0;
+            system.markAttendanceBulk(empIds, parts[1], parts[2] == "y" || parts[2] == "Y", overtime,
+                                      overtimeOverrides);
+        } else if (command == "query" || command == "explain") {
+            system.runQuery(arg, command == "explain");
+        } else if (command == "export") {
+            // <report> <csv|jsonl> <path> [from=YYYY-MM-DD] [to=YYYY-MM-DD] [dept=NAME]
+            istringstream args(arg);
+            string report, format, path, option, fromDate, toDate, dept;
+            args >> report >> format >> path;
+            while (args >> option) {
+                if (option.compare(0, 5, "from=") == 0) fromDate = option.substr(5);
+                else if (option.compare(0, 3, "to=") == 0) toDate = option.substr(3);
+                else if (option.compare(0, 5, "dept=") == 0) dept = option.substr(5);
+            }
+            ExportFilter filter;
+            if (path.empty()) {
+                cout << "Usage: export <report> <csv|jsonl> <path> [from=DATE] [to=DATE] [dept=NAME]\n";
+            } else if (buildExportFilter(fromDate, toDate, dept, filter)) {
+                system.exportReport(report, format, path, filter);
+            }
+        } else if (command == "snapshot-status") {
+            system.displaySnapshotStatus();
+        } else if (command == "payroll-summary") {
+            system.displayPayrollSummary();
+        } else if (command == "help") {
+            cout << "Commands:\n";
+            cout << "  find-employee <name or email>\n";
+            cout << "  set-department <employee id> <department>\n";
+            cout << "  set-position <employee id> <position>\n";
+            cout << "  set-email <employee id> <email>\n";
+            cout << "  set-phone <employee id> <phone>\n";
+            cout << "  group-report [department|position]\n";
+            cout << "  attendance-range <employee id> <from YYYY-MM-DD> <to YYYY-MM-DD>\n";
+            cout << "  rank <employee id>\n";
+            cout << "  top [count]\n";
+            cout << "  ranks <from rank> <to rank>\n";
+            cout << "  out-on <YYYY-MM-DD>\n";
+            cout << "  leave-coverage <from YYYY-MM-DD> <to YYYY-MM-DD> <department>\n";
+            cout << "  leave-balance <employee id> [as of YYYY-MM-DD]\n";
+            cout << "  leave-report [as of YYYY-MM-DD]\n";
+            cout << "  funnel\n";
+            cout << "  candidate-count <status>|<position>\n";
+            cout << "  notices [before notice id] [type]\n";
+            cout << "  archive-notices <before YYYY-MM-DD>\n";
+            cout << "  notice-readers <notice id>\n";
+            cout << "  unread-count <employee id>\n";
+            cout << "  bulk-attendance <target>|<date>|<y/n>[|<overtime>[|<id:hours,...>]]\n";
+            cout << "  bulk-assign <target>|<title>|<description>|<deadline>|<type>\n";
+            cout << "    target: all, dept:NAME, position:NAME or ids:ID,ID,...\n";
+            cout << "  email-project <project id> <recipient email>\n";
+            cout << "  mail-status\n";
+            cout << "  mail-flush [max seconds]\n";
+            cout << "  query <[employees|projects] where condition>\n";
+            cout << "  explain <[employees|projects] where condition>\n";
+            cout << "  export <report> <csv|jsonl> <path> [from=DATE] [to=DATE] [dept=NAME]\n";
+            cout << "    report: employees, projects, attendance, performance or year-end\n";
+            cout << "  payroll-summary\n";
+            cout << "  snapshot-status\n";
+        } else {
+            cout << "Unknown command: " << command << " (try 'help')\n";
+        }
+    }
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     HRSystem system;
     int mainChoice;
 
+    // --batch: run commands from standard input instead of the menus
+    if (argc > 1 && string(argv[1]) == "--batch") {
+        runBatch(system);
+        return 0;
+    }
+
+    // --timing: load every data file up front and show the per-file breakdown
+    if (argc > 1 && string(argv[1]) == "--timing") {
+        system.loadAllData();
+        system.displayLoadTimings();
+    }
+
     cout << "\n========================================\n";
     cout << "  WELCOME TO HR MANAGEMENT SYSTEM      \n";
     cout << "========================================\n";
@@ -399,6 +928,7 @@ int main() {
                 getline(cin, password);
 
                 if (system.authenticateHR(password)) {
+                    system.loadAllData(); // the dashboard touches every collection
                     cout << "\nLogin successful!\n";
                     pauseScreen();
                     hrManagerSession(system);
@@ -0,0 +1,295 @@
+#ifndef MVCC_H
+#define MVCC_H
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <cstdint>
+using namespace std;
+
+// Epoch-based reclamation. A reader pins the current global epoch in a slot
+// for as long as it holds pointers into shared versions; a writer that
+// unlinks an object retires it tagged with the epoch at unlink time and
+// advances the epoch. A retired object is freed once every pinned slot shows
+// a later epoch, since such readers started after the unlink and cannot have
+// seen it. Readers never block writers and never take a lock.
+class EpochDomain {
+public:
+    static const size_t MAX_READERS = 64;
+
+private:
+    struct Retired {
+        uint64_t epoch;
+        function<void()> release;
+    };
+
+    atomic<uint64_t> epoch;
+    atomic<uint64_t> slots[MAX_READERS]; // 0 = free, else the pinned epoch
+    mutex retireLock;
+    vector<Retired> retired;
+    size_t reclaimed;
+
+public:
+    // Held by a reader for the lifetime of its snapshot
+    class Pin {
+    private:
+        EpochDomain* domain;
+        size_t slot;
+
+    public:
+        Pin() : domain(nullptr), slot(0) {}
+        Pin(EpochDomain* d, size_t s) : domain(d), slot(s) {}
+        Pin(Pin&& other) : domain(other.domain), slot(other.slot) { other.domain = nullptr; }
+        Pin& operator=(Pin&& other) {
+            if (this != &other) {
+                release();
+                domain = other.domain;
+                slot = other.slot;
+                other.domain = nullptr;
+            }
+            return *this;
+        }
+        Pin(const Pin&) = delete;
+        Pin& operator=(const Pin&) = delete;
+        ~Pin() { release(); }
+
+        void release() {
+            if (domain) domain->slots[slot].store(0);
+            domain = nullptr;
+        }
+    };
+
+    EpochDomain() : epoch(1), reclaimed(0) {
+        for (auto& s : slots) s.store(0);
+    }
+
+    // Runs every pending release; no reader may still be pinned
+    ~EpochDomain() {
+        for (auto& r : retired) r.release();
+    }
+
+    // Waits only if all MAX_READERS slots are taken
+    Pin pin() {
+        while (true) {
+            for (size_t i = 0; i < MAX_READERS; i++) {
+                uint64_t expected = 0;
+                if (slots[i].load() == 0 && slots[i].compare_exchange_strong(expected, epoch.load())) {
+                    return Pin(this, i);
+                }
+            }
+            this_thread::yield();
+        }
+    }
+
+    void retire(function<void()> release) {
+        lock_guard<mutex> guard(retireLock);
+        retired.push_back({epoch.fetch_add(1), release});
+    }
+
+    // Frees what no pinned reader can still see; returns how many
+    size_t reclaim() {
+        lock_guard<mutex> guard(retireLock);
+        uint64_t oldestPinned = UINT64_MAX;
+        for (auto& s : slots) {
+            uint64_t e = s.load();
+            if (e != 0 && e < oldestPinned) oldestPinned = e;
+        }
+        size_t kept = 0, freed = 0;
+        for (size_t i = 0; i < retired.size(); i++) {
+            if (retired[i].epoch < oldestPinned) {
+                retired[i].release();
+                freed++;
+            } else {
+                retired[kept++] = move(retired[i]);
+            }
+        }
+        retired.resize(kept);
+        reclaimed += freed;
+        return freed;
+    }
+
+    size_t pinnedCount() const {
+        size_t n = 0;
+        for (auto& s : slots) n += s.load() != 0 ? 1 : 0;
+        return n;
+    }
+
+    size_t pendingCount() {
+        lock_guard<mutex> guard(retireLock);
+        return retired.size();
+    }
+
+    size_t reclaimedCount() {
+        lock_guard<mutex> guard(retireLock);
+        return reclaimed;
+    }
+};
+
+// Copy-on-write table of rows in fixed-size chunks. A version is a list of
+// chunk pointers plus a row count; commit() publishes the writer's draft as
+// the new current version in one atomic store. Updating a row copies only
+// its chunk (once per draft); appending writes past the end of the shared
+// tail chunk, which older versions never read because their row count stops
+// short of it. Replaced chunks and versions are retired to the epoch domain.
+//
+// One writer at a time (writes are serialized internally); any number of
+// concurrent readers, each holding a Snapshot.
+template <typename T, size_t CHUNK_ROWS>
+class VersionedTable {
+private:
+    struct Chunk {
+        vector<T> rows; // capacity CHUNK_ROWS, never reallocated
+        Chunk() { rows.reserve(CHUNK_ROWS); }
+    };
+
+    struct Version {
+        uint64_t number;
+        size_t size;
+        vector<Chunk*> chunks;
+    };
+
+    EpochDomain& domain;
+    atomic<Version*> current;
+    mutex writeLock;
+    Version* draft;               // unpublished, owned by the writer
+    vector<bool> ownedByDraft;    // chunk copied or created for the draft
+    vector<Chunk*> replaced;      // published chunks the draft dropped
+
+    // Caller holds writeLock
+    void openDraft() {
+        if (draft) return;
+        draft = new Version(*current.load());
+        ownedByDraft.assign(draft->chunks.size(), false);
+    }
+
+    Chunk* writableChunk(size_t c) {
+        if (!ownedByDraft[c]) {
+            Chunk* copy = new Chunk();
+            copy->rows = draft->chunks[c]->rows;
+            copy->rows.reserve(CHUNK_ROWS);
+            replaced.push_back(draft->chunks[c]);
+            draft->chunks[c] = copy;
+            ownedByDraft[c] = true;
+        }
+        return draft->chunks[c];
+    }
+
+public:
+    class Snapshot {
+    private:
+        EpochDomain::Pin pin;
+        const Version* version;
+
+    public:
+        Snapshot(EpochDomain::Pin p, const Version* v) : pin(move(p)), version(v) {}
+
+        size_t size() const { return version->size; }
+        uint64_t number() const { return version->number; }
+
+        const T& operator[](size_t row) const {
+            return version->chunks[row / CHUNK_ROWS]->rows[row % CHUNK_ROWS];
+        }
+
+        // Rows in order, a chunk at a time
+        template <typename F>
+        void forEach(F f) const {
+            size_t left = version->size;
+            for (const Chunk* chunk : version->chunks) {
+                size_t n = left < CHUNK_ROWS ? left : CHUNK_ROWS;
+                const T* rows = chunk->rows.data();
+                for (size_t i = 0; i < n; i++) f(rows[i]);
+                left -= n;
+                if (left == 0) break;
+            }
+        }
+    };
+
+    explicit VersionedTable(EpochDomain& d) : domain(d), draft(nullptr) {
+        current.store(new Version{0, 0, {}});
+    }
+
+    ~VersionedTable() {
+        if (draft) {
+            for (size_t c = 0; c < draft->chunks.size(); c++) {
+                if (ownedByDraft[c]) delete draft->chunks[c];
+            }
+            delete draft;
+        }
+        Version* v = current.load();
+        for (Chunk* chunk : v->chunks) delete chunk; // includes any in replaced
+        delete v;
+    }
+
+    Snapshot snapshot() const {
+        EpochDomain::Pin pin = domain.pin();
+        return Snapshot(move(pin), current.load());
+    }
+
+    size_t size() const { return current.load()->size; }
+    uint64_t versionNumber() const { return current.load()->number; }
+
+    void append(const T& row) {
+        lock_guard<mutex> guard(writeLock);
+        openDraft();
+        if (draft->size % CHUNK_ROWS == 0) {
+            draft->chunks.push_back(new Chunk());
+            ownedByDraft.push_back(true);
+        }
+        draft->chunks.back()->rows.push_back(row);
+        draft->size++;
+    }
+
+    void update(size_t row, const T& value) {
+        lock_guard<mutex> guard(writeLock);
+        openDraft();
+        writableChunk(row / CHUNK_ROWS)->rows[row % CHUNK_ROWS] = value;
+    }
+
+    // update() for an existing row, append() for the next one
+    void put(size_t row, const T& value) {
+        size_t pending;
+        {
+            lock_guard<mutex> guard(writeLock);
+            pending = draft ? draft->size : current.load()->size;
+        }
+        if (row < pending) update(row, value);
+        else append(value);
+    }
+
+    // Drops every row (a reload); readers keep their old versions
+    void clear() {
+        lock_guard<mutex> guard(writeLock);
+        openDraft();
+        for (size_t c = 0; c < draft->chunks.size(); c++) {
+            if (ownedByDraft[c]) delete draft->chunks[c];
+            else replaced.push_back(draft->chunks[c]);
+        }
+        draft->chunks.clear();
+        ownedByDraft.clear();
+        draft->size = 0;
+    }
+
+    // Publishes the draft, retires what it replaced and frees whatever no
+    // reader can still reach. Returns false if there was nothing to commit.
+    bool commit() {
+        lock_guard<mutex> guard(writeLock);
+        if (!draft) return false;
+        Version* old = current.load();
+        draft->number = old->number + 1;
+        current.store(draft);
+        draft = nullptr;
+        ownedByDraft.clear();
+        vector<Chunk*> dropped;
+        dropped.swap(replaced);
+        domain.retire([old, dropped]() {
+            for (Chunk* chunk : dropped) delete chunk;
+            delete old;
+        });
+        domain.reclaim();
+        return true;
+    }
+};
+
+#endif
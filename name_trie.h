@@ -0,0 +1,146 @@
+#ifndef NAME_TRIE_H
+#define NAME_TRIE_H
+
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+#include <cctype>
+using namespace std;
+
+// Character trie mapping lower-cased keys to person IDs. Supports prefix
+// lookup and typo-tolerant prefix lookup within a bounded edit distance
+// (Levenshtein rows carried down the trie, pruned once every cell exceeds
+// the bound).
+class NameTrie {
+private:
+    struct Node {
+        vector<pair<char, int>> children; // sorted by character
+        vector<int> ids;                  // IDs whose key ends here, ascending
+    };
+
+    vector<Node> nodes;
+
+    int findChild(int node, char c) const {
+        const vector<pair<char, int>>& kids = nodes[node].children;
+        auto it = lower_bound(kids.begin(), kids.end(), make_pair(c, -1));
+        if (it != kids.end() && it->first == c) return it->second;
+        return -1;
+    }
+
+    int getOrAddChild(int node, char c) {
+        int existing = findChild(node, c);
+        if (existing != -1) return existing;
+        int created = (int)nodes.size();
+        nodes.push_back(Node()); // may reallocate, so look the parent up again
+        vector<pair<char, int>>& kids = nodes[node].children;
+        kids.insert(lower_bound(kids.begin(), kids.end(), make_pair(c, -1)), make_pair(c, created));
+        return created;
+    }
+
+    void collectSubtree(int node, int distance, size_t limit, unordered_set<int>& seen,
+                        vector<pair<int, int>>& out) const {
+        for (int id : nodes[node].ids) {
+            if (out.size() >= limit) return;
+            if (seen.insert(id).second) out.push_back({id, distance});
+        }
+        for (const auto& kid : nodes[node].children) {
+            if (out.size() >= limit) return;
+            collectSubtree(kid.second, distance, limit, seen, out);
+        }
+    }
+
+    // prevRow[j] = edit distance between the path to `node` and query[0..j).
+    // Once the whole query has been matched within maxEdits, every key below
+    // this node is a (fuzzy) prefix match.
+    void fuzzyWalk(int node, const string& query, const vector<int>& prevRow, int maxEdits,
+                   size_t limit, unordered_set<int>& seen, vector<pair<int, int>>& out) const {
+        size_t m = query.size();
+        for (const auto& kid : nodes[node].children) {
+            if (out.size() >= limit) return;
+            vector<int> row(m + 1);
+            row[0] = prevRow[0] + 1;
+            int rowMin = row[0];
+            for (size_t j = 1; j <= m; j++) {
+                int cost = (query[j - 1] == kid.first) ? 0 : 1;
+                row[j] = min(min(prevRow[j] + 1, row[j - 1] + 1), prevRow[j - 1] + cost);
+                rowMin = min(rowMin, row[j]);
+            }
+            if (row[m] <= maxEdits) {
+                collectSubtree(kid.second, row[m], limit, seen, out);
+            } else if (rowMin <= maxEdits) {
+                fuzzyWalk(kid.second, query, row, maxEdits, limit, seen, out);
+            }
+        }
+    }
+
+public:
+    NameTrie() { nodes.push_back(Node()); }
+
+    static string normalize(const string& key) {
+        string out;
+        out.reserve(key.size());
+        for (char ch : key) out += (char)tolower((unsigned char)ch);
+        return out;
+    }
+
+    void insert(const string& key, int id) {
+        string k = normalize(key);
+        if (k.empty()) return;
+        int node = 0;
+        for (char c : k) node = getOrAddChild(node, c);
+        // IDs mostly arrive in increasing order (loading, registration), so
+        // keeping the list sorted makes the duplicate check O(1) for a common
+        // key such as a shared first name instead of a scan of every holder.
+        vector<int>& ids = nodes[node].ids;
+        if (ids.empty() || ids.back() < id) {
+            ids.push_back(id);
+        } else {
+            auto it = lower_bound(ids.begin(), ids.end(), id);
+            if (*it != id) ids.insert(it, id);
+        }
+    }
+
+    void remove(const string& key, int id) {
+        string k = normalize(key);
+        int node = 0;
+        for (char c : k) {
+            node = findChild(node, c);
+            if (node == -1) return;
+        }
+        vector<int>& ids = nodes[node].ids;
+        auto it = lower_bound(ids.begin(), ids.end(), id);
+        if (it != ids.end() && *it == id) ids.erase(it);
+    }
+
+    void clear() {
+        nodes.clear();
+        nodes.push_back(Node());
+    }
+
+    // Edit budget scaled to the query length: short queries must match exactly.
+    static int defaultMaxEdits(const string& query) {
+        if (query.size() <= 3) return 0;
+        if (query.size() <= 6) return 1;
+        return 2;
+    }
+
+    // Returns up to `limit` (id, edits) pairs, exact prefix matches first.
+    vector<pair<int, int>> search(const string& query, int maxEdits, size_t limit) const {
+        string q = normalize(query);
+        vector<pair<int, int>> out;
+        unordered_set<int> seen;
+        if (q.empty() || limit == 0) return out;
+
+        // Widen the edit budget one step at a time so closer matches always
+        // fill the result list before more distant ones.
+        vector<int> firstRow(q.size() + 1);
+        for (size_t j = 0; j <= q.size(); j++) firstRow[j] = (int)j;
+        for (int edits = 0; edits <= maxEdits && out.size() < limit; edits++) {
+            fuzzyWalk(0, q, firstRow, edits, limit, seen, out);
+        }
+        return out;
+    }
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef NOTICE_FEED_H
+#define NOTICE_FEED_H
+
+#include "intern_pool.h"
+#include <vector>
+#include <unordered_map>
+using namespace std;
+
+// Per-type feeds over the hot notice list. Notices are kept in posting (ID)
+// order, so the overall feed is simply that list read backwards; each type
+// feed is the ascending list of positions of that type's notices in it.
+// Reading a page newest-first is one binary search for the cursor plus the
+// page itself, however many notices have been posted.
+class NoticeFeed {
+private:
+    unordered_map<uint32_t, vector<size_t>> byType; // keyed by type symbol ID
+    static const vector<size_t>& empty() {
+        static const vector<size_t> none;
+        return none;
+    }
+
+public:
+    NoticeFeed() {}
+
+    // Positions must be added in increasing order.
+    void add(Symbol type, size_t position) { byType[type.getId()].push_back(position); }
+
+    void clear() { byType.clear(); }
+
+    const vector<size_t>& positionsFor(Symbol type) const {
+        auto it = byType.find(type.getId());
+        return it == byType.end() ? empty() : it->second;
+    }
+};
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef PAYROLL_KERNELS_H
+#define PAYROLL_KERNELS_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+using namespace std;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HR_HAVE_AVX2_KERNELS 1
+#define HR_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+// Structure-of-arrays copy of employee IDs and salaries. Row i always
+// mirrors HRSystem::employees[i], so bulk payroll work streams two dense
+// arrays instead of walking whole Employee objects.
+class SalaryColumn {
+private:
+    vector<int> ids;
+    vector<double> salaries;
+
+public:
+    SalaryColumn() {}
+
+    void add(int id, double salary) {
+        ids.push_back(id);
+        salaries.push_back(salary);
+    }
+
+    void setSalary(size_t row, double salary) { salaries[row] = salary; }
+    void clear() { ids.clear(); salaries.clear(); }
+    void reserve(size_t n) { ids.reserve(n); salaries.reserve(n); }
+
+    size_t size() const { return salaries.size(); }
+    int getId(size_t row) const { return ids[row]; }
+    double getSalary(size_t row) const { return salaries[row]; }
+    const double* salaryData() const { return salaries.data(); }
+    double* salaryData() { return salaries.data(); }
+};
+
+// Year-end raise bands. yearEndEvaluation and the kernels share this table
+// so they can never disagree about who gets what.
+namespace RaiseBands {
+    const int BAND_COUNT = 6;
+
+    inline int bandForScore(double score) {
+        if (score >= 90) return 0;
+        if (score >= 85) return 1;
+        if (score >= 75) return 2;
+        if (score >= 65) return 3;
+        if (score >= 50) return 4;
+        return 5;
+    }
+
+    // Multiplier applied as salary += salary * rate. The demotion band uses
+    // -0.10, and s * -0.10 == -(s * 0.10) exactly, so this matches the
+    // original "salaryIncrease = -(salary * 0.10)" bit for bit.
+    inline double rateForBand(int band) {
+        static const double rates[BAND_COUNT] = {0.20, 0.15, 0.10, 0.05, 0.0, -0.10};
+        return rates[band];
+    }
+
+    inline string actionForBand(int band) {
+        static const char* actions[BAND_COUNT] = {
+            "PROMOTION + 20% Salary Increase", "15% Salary Increase", "10% Salary Increase",
+            "5% Salary Increase", "No Salary Change", "DEMOTION - 10% Salary Decrease"};
+        return actions[band];
+    }
+}
+
+// Bulk payroll kernels with an AVX2 path and a scalar fallback, chosen at
+// run time. Raises are computed as a separate multiply and add (never fused)
+// so every path is bit-identical to Employee::operator+=(salary * rate).
+namespace PayrollKernels {
+
+    inline void applyRaisesScalar(double* salaries, const double* rates, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            double increment = salaries[i] * rates[i];
+            salaries[i] = salaries[i] + increment;
+        }
+    }
+
+    inline double sumScalar(const double* salaries, size_t n) {
+        // Four partial sums, added in the same order as the AVX2 lanes, so
+        // both paths return the same total.
+        double lane[4] = {0, 0, 0, 0};
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            lane[0] += salaries[i];
+            lane[1] += salaries[i + 1];
+            lane[2] += salaries[i + 2];
+            lane[3] += salaries[i + 3];
+        }
+        double total = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+        for (; i < n; i++) total += salaries[i];
+        return total;
+    }
+
+    // Counts salaries into buckets of bucketWidth; the last bucket also takes
+    // everything above the range and negative salaries land in bucket 0.
+    inline void histogramScalar(const double* salaries, size_t n, double bucketWidth,
+                                vector<size_t>& counts) {
+        int last = (int)counts.size() - 1;
+        for (size_t i = 0; i < n; i++) {
+            double b = salaries[i] / bucketWidth;
+            int bucket = b <= 0 ? 0 : (b >= last ? last : (int)b);
+            counts[bucket]++;
+        }
+    }
+
+#ifdef HR_HAVE_AVX2_KERNELS
+    HR_TARGET_AVX2 inline void applyRaisesAvx2(double* salaries, const double* rates, size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d s = _mm256_loadu_pd(salaries + i);
+            __m256d r = _mm256_loadu_pd(rates + i);
+            _mm256_storeu_pd(salaries + i, _mm256_add_pd(s, _mm256_mul_pd(s, r)));
+        }
+        applyRaisesScalar(salaries + i, rates + i, n - i);
+    }
+
+    HR_TARGET_AVX2 inline double sumAvx2(const double* salaries, size_t n) {
+        __m256d acc = _mm256_setzero_pd();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            acc = _mm256_add_pd(acc, _mm256_loadu_pd(salaries + i));
+        }
+        double lane[4];
+        _mm256_storeu_pd(lane, acc);
+        double total = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+        for (; i < n; i++) total += salaries[i];
+        return total;
+    }
+
+    HR_TARGET_AVX2 inline void histogramAvx2(const double* salaries, size_t n, double bucketWidth,
+                                             vector<size_t>& counts) {
+        int last = (int)counts.size() - 1;
+        __m256d width = _mm256_set1_pd(bucketWidth);
+        __m256d zero = _mm256_setzero_pd();
+        __m256d top = _mm256_set1_pd((double)last);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d b = _mm256_div_pd(_mm256_loadu_pd(salaries + i), width);
+            b = _mm256_min_pd(_mm256_max_pd(b, zero), top);
+            int buckets[4];
+            _mm_storeu_si128((__m128i*)buckets, _mm256_cvttpd_epi32(b));
+            counts[buckets[0]]++;
+            counts[buckets[1]]++;
+            counts[buckets[2]]++;
+            counts[buckets[3]]++;
+        }
+        histogramScalar(salaries + i, n - i, bucketWidth, counts);
+    }
+#endif
+
+    inline bool hasAvx2() {
+#ifdef HR_HAVE_AVX2_KERNELS
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    inline void applyRaises(double* salaries, const double* rates, size_t n) {
+#ifdef HR_HAVE_AVX2_KERNELS
+        if (hasAvx2()) { applyRaisesAvx2(salaries, rates, n); return; }
+#endif
+        applyRaisesScalar(salaries, rates, n);
+    }
+
+    inline double sum(const double* salaries, size_t n) {
+#ifdef HR_HAVE_AVX2_KERNELS
+        if (hasAvx2()) return sumAvx2(salaries, n);
+#endif
+        return sumScalar(salaries, n);
+    }
+
+    inline vector<size_t> histogram(const double* salaries, size_t n, double bucketWidth,
+                                    size_t bucketCount) {
+        vector<size_t> counts(bucketCount == 0 ? 1 : bucketCount, 0);
+        if (bucketWidth <= 0) {
+            counts[0] = n;
+            return counts;
+        }
+#ifdef HR_HAVE_AVX2_KERNELS
+        if (hasAvx2()) { histogramAvx2(salaries, n, bucketWidth, counts); return counts; }
+#endif
+        histogramScalar(salaries, n, bucketWidth, counts);
+        return counts;
+    }
+}
+
+#endif
@@ -0,0 +1,382 @@
+#ifndef QUERY_ENGINE_H
+#define QUERY_ENGINE_H
+
+#include "intern_pool.h"
+#include "date_utils.h"
+#include <string>
+#include <vector>
+#include <sstream>
+#include <cctype>
+#include <cstdlib>
+using namespace std;
+
+// Small filter language over employees and projects:
+//
+//   [employees|projects] [where] <expr>
+//   expr       := term { or term }
+//   term       := factor { and factor }
+//   factor     := not factor | ( expr ) | field op value
+//   op         := = != < <= > >= contains
+//
+// e.g.  department = "Eng" and salary > 80000 and joiningDate >= 2024-01-01
+//
+// The text is parsed once into a typed predicate tree: every comparison
+// knows its field's type, and its literal is already converted (number, day
+// number, or the existing interned symbol once bound), so evaluating a row
+// does no parsing of the query. Planning and execution over the actual collections live in
+// HRSystem, which owns the indexes.
+namespace Query {
+
+    enum Entity { EMPLOYEES, PROJECTS };
+    enum ValueType { NUMBER, TEXT, SYMBOL, DATE };
+    enum Op { EQ, NE, LT, LE, GT, GE, CONTAINS };
+
+    enum FieldId {
+        EMP_ID, EMP_NAME, EMP_EMAIL, EMP_PHONE, EMP_DEPARTMENT, EMP_POSITION,
+        EMP_SALARY, EMP_JOINING_DATE, EMP_PROJECT_COUNT,
+        PROJ_ID, PROJ_TITLE, PROJ_EMPLOYEE_ID, PROJ_ASSIGNED_TO, PROJ_STATUS,
+        PROJ_TYPE, PROJ_DEADLINE, PROJ_SUBMISSION_DATE
+    };
+
+    struct Field {
+        const char* name;
+        ValueType type;
+        FieldId id;
+    };
+
+    inline const vector<Field>& fieldsFor(Entity entity) {
+        static const vector<Field> employeeFields = {
+            {"id", NUMBER, EMP_ID}, {"name", TEXT, EMP_NAME}, {"email", TEXT, EMP_EMAIL},
+            {"phone", TEXT, EMP_PHONE}, {"department", SYMBOL, EMP_DEPARTMENT},
+            {"position", SYMBOL, EMP_POSITION}, {"salary", NUMBER, EMP_SALARY},
+            {"joiningDate", DATE, EMP_JOINING_DATE}, {"projectCount", NUMBER, EMP_PROJECT_COUNT}};
+        static const vector<Field> projectFields = {
+            {"id", NUMBER, PROJ_ID}, {"title", TEXT, PROJ_TITLE},
+            {"employeeId", NUMBER, PROJ_EMPLOYEE_ID}, {"assignedTo", SYMBOL, PROJ_ASSIGNED_TO},
+            {"status", SYMBOL, PROJ_STATUS}, {"type", SYMBOL, PROJ_TYPE},
+            {"deadline", DATE, PROJ_DEADLINE}, {"submissionDate", DATE, PROJ_SUBMISSION_DATE}};
+        return entity == EMPLOYEES ? employeeFields : projectFields;
+    }
+
+    inline string lowercase(string text) {
+        for (char& ch : text) ch = (char)tolower((unsigned char)ch);
+        return text;
+    }
+
+    struct Node {
+        enum Kind { AND, OR, NOT, COMPARE };
+        Kind kind;
+        int left;   // AND/OR operands; NOT's operand is left
+        int right;
+        FieldId field;
+        ValueType type;
+        Op op;
+        double number;  // NUMBER literal
+        int day;        // DATE literal
+        string text;    // TEXT/SYMBOL literal (lower-cased for contains), or as written
+        Symbol symbol;  // SYMBOL literal, once bound
+        bool symbolKnown; // false if no record holds the SYMBOL literal
+        Node() : kind(COMPARE), left(-1), right(-1), field(EMP_ID), type(NUMBER), op(EQ),
+                 number(0), day(0), symbolKnown(false) {}
+    };
+
+    // A parsed query; nodes[root] is the whole predicate (root -1 = no filter)
+    struct Program {
+        Entity entity;
+        vector<Node> nodes;
+        int root;
+        Program() : entity(EMPLOYEES), root(-1) {}
+    };
+
+    inline const char* opName(Op op) {
+        static const char* names[] = {"=", "!=", "<", "<=", ">", ">=", "contains"};
+        return names[op];
+    }
+
+    inline const char* fieldName(Entity entity, FieldId id) {
+        for (const auto& f : fieldsFor(entity)) {
+            if (f.id == id) return f.name;
+        }
+        return "?";
+    }
+
+    // Readable form of a subtree, for EXPLAIN
+    inline string describe(const Program& p, int n) {
+        const Node& node = p.nodes[n];
+        switch (node.kind) {
+            case Node::AND: return describe(p, node.left) + " and " + describe(p, node.right);
+            case Node::OR: return "(" + describe(p, node.left) + " or " + describe(p, node.right) + ")";
+            case Node::NOT: return "not (" + describe(p, node.left) + ")";
+            default: break;
+        }
+        ostringstream out;
+        out << fieldName(p.entity, node.field) << " " << opName(node.op) << " ";
+        if (node.type == NUMBER) out << node.number;
+        else if (node.type == DATE) out << DateUtils::formatDate(node.day);
+        else out << "\"" << node.text << "\"";
+        return out.str();
+    }
+
+    // Resolves SYMBOL literals against the pool without interning them, so a
+    // query never adds strings; run once the queried records are loaded. A
+    // literal no record holds matches nothing under =.
+    inline void bindSymbols(Program& p) {
+        for (auto& node : p.nodes) {
+            if (node.kind == Node::COMPARE && node.type == SYMBOL && node.op != CONTAINS) {
+                node.symbolKnown = Symbol::find(node.text, node.symbol);
+            }
+        }
+    }
+
+    template <typename T>
+    inline bool compareValues(const T& a, Op op, const T& b) {
+        switch (op) {
+            case EQ: return a == b;
+            case NE: return !(a == b);
+            case LT: return a < b;
+            case LE: return !(b < a);
+            case GT: return b < a;
+            case GE: return !(a < b);
+            default: return false;
+        }
+    }
+
+    // Row must provide number(FieldId), text(FieldId), symbol(FieldId) and
+    // day(FieldId, int&) (false when the stored date is not YYYY-MM-DD).
+    template <typename Row>
+    bool matches(const Program& p, int n, const Row& row) {
+        const Node& node = p.nodes[n];
+        switch (node.kind) {
+            case Node::AND: return matches(p, node.left, row) && matches(p, node.right, row);
+            case Node::OR: return matches(p, node.left, row) || matches(p, node.right, row);
+            case Node::NOT: return !matches(p, node.left, row);
+            default: break;
+        }
+        switch (node.type) {
+            case NUMBER:
+                return compareValues(row.number(node.field), node.op, node.number);
+            case DATE: {
+                int day;
+                return row.day(node.field, day) && compareValues(day, node.op, node.day);
+            }
+            case SYMBOL: {
+                Symbol value = row.symbol(node.field);
+                if (node.op == EQ) return node.symbolKnown && value == node.symbol;
+                if (node.op == NE) return !node.symbolKnown || value != node.symbol;
+                if (node.op == CONTAINS) return lowercase(value.str()).find(node.text) != string::npos;
+                return compareValues(value.str(), node.op, node.text);
+            }
+            case TEXT: {
+                string value = row.text(node.field);
+                if (node.op == CONTAINS) return lowercase(value).find(node.text) != string::npos;
+                return compareValues(value, node.op, node.text);
+            }
+        }
+        return false;
+    }
+
+    // Recursive-descent parser; on failure error describes the problem.
+    class Parser {
+    private:
+        enum TokenKind { WORD, NUMBER_LIT, STRING_LIT, OPERATOR, LPAREN, RPAREN, END };
+        struct Token {
+            TokenKind kind;
+            string text;
+            size_t pos;
+        };
+
+        vector<Token> tokens;
+        size_t next;
+        Program program;
+        string error;
+
+        bool fail(const string& message, size_t pos) {
+            if (error.empty()) error = message + " (at column " + to_string(pos + 1) + ")";
+            return false;
+        }
+
+        bool tokenize(const string& text) {
+            size_t i = 0;
+            while (i < text.size()) {
+                char ch = text[i];
+                if (isspace((unsigned char)ch)) { i++; continue; }
+                size_t start = i;
+                if (ch == '(' || ch == ')') {
+                    tokens.push_back({ch == '(' ? LPAREN : RPAREN, string(1, ch), start});
+                    i++;
+                } else if (ch == '"' || ch == '\'') {
+                    size_t close = text.find(ch, i + 1);
+                    if (close == string::npos) return fail("Unterminated string", start);
+                    tokens.push_back({STRING_LIT, text.substr(i + 1, close - i - 1), start});
+                    i = close + 1;
+                } else if (ch == '=' || ch == '!' || ch == '<' || ch == '>') {
+                    string op(1, ch);
+                    if (i + 1 < text.size() && (text[i + 1] == '=' || (ch == '<' && text[i + 1] == '>'))) {
+                        op += text[i + 1];
+                    }
+                    if (op == "!") return fail("Expected '!='", start);
+                    tokens.push_back({OPERATOR, op, start});
+                    i += op.size();
+                } else if (isdigit((unsigned char)ch) || ch == '-' || ch == '.') {
+                    // numbers, and dates such as 2024-01-01
+                    i++;
+                    while (i < text.size() && (isdigit((unsigned char)text[i]) || text[i] == '.' || text[i] == '-')) i++;
+                    tokens.push_back({NUMBER_LIT, text.substr(start, i - start), start});
+                } else if (isalpha((unsigned char)ch) || ch == '_') {
+                    // '-' allowed inside, for values such as Long-term
+                    while (i < text.size() && (isalnum((unsigned char)text[i]) || text[i] == '_' || text[i] == '-')) i++;
+                    tokens.push_back({WORD, text.substr(start, i - start), start});
+                } else {
+                    return fail(string("Unexpected character '") + ch + "'", start);
+                }
+            }
+            tokens.push_back({END, "", text.size()});
+            return true;
+        }
+
+        int failNode(const string& message, size_t pos) {
+            fail(message, pos);
+            return -1;
+        }
+
+        const Token& peek() const { return tokens[next]; }
+
+        bool peekKeyword(const char* word) const {
+            return peek().kind == WORD && lowercase(peek().text) == word;
+        }
+
+        int addNode(const Node& node) {
+            program.nodes.push_back(node);
+            return (int)program.nodes.size() - 1;
+        }
+
+        int binary(Node::Kind kind, int left, int right) {
+            Node node;
+            node.kind = kind;
+            node.left = left;
+            node.right = right;
+            return addNode(node);
+        }
+
+        int parseExpr() {
+            int left = parseTerm();
+            while (left >= 0 && peekKeyword("or")) {
+                next++;
+                int right = parseTerm();
+                if (right < 0) return -1;
+                left = binary(Node::OR, left, right);
+            }
+            return left;
+        }
+
+        int parseTerm() {
+            int left = parseFactor();
+            while (left >= 0 && peekKeyword("and")) {
+                next++;
+                int right = parseFactor();
+                if (right < 0) return -1;
+                left = binary(Node::AND, left, right);
+            }
+            return left;
+        }
+
+        int parseFactor() {
+            if (peekKeyword("not")) {
+                next++;
+                int operand = parseFactor();
+                return operand < 0 ? -1 : binary(Node::NOT, operand, -1);
+            }
+            if (peek().kind == LPAREN) {
+                next++;
+                int inner = parseExpr();
+                if (inner < 0) return -1;
+                if (peek().kind != RPAREN) return failNode("Expected ')'", peek().pos);
+                next++;
+                return inner;
+            }
+            return parseComparison();
+        }
+
+        int parseComparison() {
+            const Token& fieldToken = peek();
+            if (fieldToken.kind != WORD) return failNode("Expected a field name", fieldToken.pos);
+            const Field* field = nullptr;
+            for (const auto& f : fieldsFor(program.entity)) {
+                if (lowercase(f.name) == lowercase(fieldToken.text)) field = &f;
+            }
+            if (!field) return failNode("Unknown field '" + fieldToken.text + "'", fieldToken.pos);
+            next++;
+
+            Node node;
+            node.field = field->id;
+            node.type = field->type;
+            const Token& opToken = peek();
+            if (opToken.kind == OPERATOR) {
+                const string& op = opToken.text;
+                node.op = (op == "=" || op == "==") ? EQ : (op == "!=" || op == "<>") ? NE
+                        : op == "<" ? LT : op == "<=" ? LE : op == ">" ? GT : GE;
+            } else if (peekKeyword("contains")) {
+                node.op = CONTAINS;
+                if (field->type != TEXT && field->type != SYMBOL) {
+                    return failNode("'contains' needs a text field", opToken.pos);
+                }
+            } else {
+                return failNode("Expected a comparison operator", opToken.pos);
+            }
+            next++;
+
+            const Token& value = peek();
+            if (value.kind != WORD && value.kind != NUMBER_LIT && value.kind != STRING_LIT) {
+                return failNode("Expected a value", value.pos);
+            }
+            next++;
+            if (field->type == NUMBER) {
+                char* end = nullptr;
+                node.number = strtod(value.text.c_str(), &end);
+                if (value.kind == STRING_LIT || value.text.empty() || *end != '\0') {
+                    return failNode("Expected a number for " + string(field->name), value.pos);
+                }
+            } else if (field->type == DATE) {
+                if (!DateUtils::parseDate(value.text, node.day)) {
+                    return failNode("Expected a YYYY-MM-DD date for " + string(field->name), value.pos);
+                }
+            } else if (node.op == CONTAINS) {
+                node.text = lowercase(value.text);
+            } else {
+                node.text = value.text;
+            }
+            return addNode(node);
+        }
+
+    public:
+        Parser() : next(0) {}
+
+        // Returns false and sets getError() if the text is not a valid query
+        bool parse(const string& text, Program& out) {
+            tokens.clear();
+            next = 0;
+            program = Program();
+            error.clear();
+            if (!tokenize(text)) return false;
+
+            if (peekKeyword("employees")) {
+                next++;
+            } else if (peekKeyword("projects")) {
+                program.entity = PROJECTS;
+                next++;
+            }
+            if (peekKeyword("where")) next++;
+            if (peek().kind != END) {
+                program.root = parseExpr();
+                if (program.root < 0) return false;
+                if (peek().kind != END) return fail("Unexpected '" + peek().text + "'", peek().pos);
+            }
+            out = program;
+            return true;
+        }
+
+        string getError() const { return error; }
+    };
+}
+
+#endif
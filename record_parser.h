@@ -0,0 +1,99 @@
+#ifndef RECORD_PARSER_H
+#define RECORD_PARSER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <memory_resource>
+#include <fstream>
+#include <charconv>
+#include <algorithm>
+using namespace std;
+
+// Monotonic arena for one load generation. Everything a loader allocates
+// from it (file bytes, line tables, column storage) is bump-allocated and
+// given back in one step by reset() or when the arena is destroyed, instead
+// of one free per token.
+class LoadArena {
+private:
+    static const size_t INITIAL_BYTES = 64 * 1024;
+    unique_ptr<pmr::monotonic_buffer_resource> arena;
+
+public:
+    LoadArena() : arena(new pmr::monotonic_buffer_resource(INITIAL_BYTES)) {}
+
+    pmr::memory_resource* resource() { return arena.get(); }
+
+    // Frees the whole generation. Anything still pointing into it must have
+    // been dropped or rebound to another resource first.
+    void reset() { arena->release(); }
+};
+
+// Allocation-free parsing of the pipe-delimited .dat records. Fields are
+// string_views into the line, which is itself a view into the file buffer.
+namespace RecordParser {
+
+    // Splits line at '|' into at most maxFields views (a trailing '\r' from
+    // CRLF files is dropped). Returns the number of fields in the line, which
+    // may exceed maxFields; the extra fields are ignored.
+    inline size_t splitFields(string_view line, string_view* fields, size_t maxFields) {
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        size_t count = 0;
+        size_t start = 0;
+        while (true) {
+            size_t bar = line.find('|', start);
+            string_view field = line.substr(start, bar == string_view::npos ? string_view::npos : bar - start);
+            if (count < maxFields) fields[count] = field;
+            count++;
+            if (bar == string_view::npos) break;
+            start = bar + 1;
+        }
+        return count;
+    }
+
+    // Leading blanks and a '+' are accepted and trailing text is ignored, as
+    // with stoi/stod, but a field with no number is rejected instead of
+    // throwing.
+    inline string_view numberStart(string_view text) {
+        size_t i = 0;
+        while (i < text.size() && (text[i] == ' ' || text[i] == '\t')) i++;
+        if (i < text.size() && text[i] == '+') i++;
+        return text.substr(i);
+    }
+
+    inline bool parseInt(string_view text, int& value) {
+        text = numberStart(text);
+        return from_chars(text.data(), text.data() + text.size(), value).ec == errc();
+    }
+
+    inline bool parseDouble(string_view text, double& value) {
+        text = numberStart(text);
+        return from_chars(text.data(), text.data() + text.size(), value).ec == errc();
+    }
+
+    // Reads the whole file into mem and records a view of each line. Returns
+    // false if the file cannot be opened.
+    inline bool readLines(const string& path, pmr::memory_resource* mem, pmr::vector<string_view>& lines) {
+        ifstream in(path, ios::binary | ios::ate);
+        if (!in.is_open()) return false;
+        streamsize size = in.tellg();
+        if (size <= 0) return true;
+        char* data = static_cast<char*>(mem->allocate((size_t)size, 1));
+        in.seekg(0);
+        in.read(data, size);
+        string_view contents(data, (size_t)in.gcount());
+
+        lines.reserve(lines.size() + count(contents.begin(), contents.end(), '\n') + 1);
+        size_t start = 0;
+        while (start < contents.size()) {
+            size_t nl = contents.find('\n', start);
+            if (nl == string_view::npos) nl = contents.size();
+            lines.push_back(contents.substr(start, nl - start));
+            start = nl + 1;
+        }
+        return true;
+    }
+}
+
+#endif
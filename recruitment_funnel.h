@@ -0,0 +1,102 @@
+#ifndef RECRUITMENT_FUNNEL_H
+#define RECRUITMENT_FUNNEL_H
+
+#include "intern_pool.h"
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <algorithm>
+using namespace std;
+
+// Candidate counts per (position, status), maintained as candidates are
+// added and move between statuses, so funnel and conversion questions are
+// answered from counters instead of a scan over every candidate.
+class RecruitmentFunnel {
+public:
+    enum Stage { APPLIED, INTERVIEW, SELECTED, REJECTED, OTHER, STAGE_COUNT };
+    typedef array<int, STAGE_COUNT> Counts;
+
+private:
+    unordered_map<uint32_t, Counts> byPosition; // keyed by position symbol ID
+
+    static Counts zeroCounts() {
+        Counts counts;
+        counts.fill(0);
+        return counts;
+    }
+
+public:
+    RecruitmentFunnel() {}
+
+    static Stage stageOf(Symbol status) {
+        static const Symbol applied("Applied");
+        static const Symbol interview("Interview Scheduled");
+        static const Symbol selected("Selected");
+        static const Symbol rejected("Rejected");
+        if (status == applied) return APPLIED;
+        if (status == interview) return INTERVIEW;
+        if (status == selected) return SELECTED;
+        if (status == rejected) return REJECTED;
+        return OTHER;
+    }
+
+    static bool isKnownStatus(Symbol status) { return stageOf(status) != OTHER; }
+
+    // The status symbol named by text, looked up without interning the input;
+    // false unless text is one of the four stages
+    static bool parseStatus(string_view text, Symbol& status) {
+        stageOf(Symbol()); // interns the stage names on first use
+        return Symbol::find(text, status) && isKnownStatus(status);
+    }
+
+    void add(Symbol position, Symbol status) {
+        auto it = byPosition.find(position.getId());
+        if (it == byPosition.end()) it = byPosition.emplace(position.getId(), zeroCounts()).first;
+        it->second[stageOf(status)]++;
+    }
+
+    void move(Symbol position, Symbol fromStatus, Symbol toStatus) {
+        auto it = byPosition.find(position.getId());
+        if (it == byPosition.end()) return;
+        it->second[stageOf(fromStatus)]--;
+        it->second[stageOf(toStatus)]++;
+    }
+
+    void clear() { byPosition.clear(); }
+
+    int count(Symbol position, Symbol status) const {
+        auto it = byPosition.find(position.getId());
+        return it == byPosition.end() ? 0 : it->second[stageOf(status)];
+    }
+
+    Counts countsFor(Symbol position) const {
+        auto it = byPosition.find(position.getId());
+        return it == byPosition.end() ? zeroCounts() : it->second;
+    }
+
+    Counts totals() const {
+        Counts sum = zeroCounts();
+        for (const auto& entry : byPosition) {
+            for (int s = 0; s < STAGE_COUNT; s++) sum[s] += entry.second[s];
+        }
+        return sum;
+    }
+
+    // Position names, alphabetically
+    vector<string> positions() const {
+        vector<string> names;
+        for (const auto& entry : byPosition) {
+            names.push_back(InternPool::instance().resolve(entry.first));
+        }
+        sort(names.begin(), names.end());
+        return names;
+    }
+
+    static int total(const Counts& counts) {
+        int sum = 0;
+        for (int c : counts) sum += c;
+        return sum;
+    }
+};
+
+#endif
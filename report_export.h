@@ -0,0 +1,233 @@
+#ifndef REPORT_EXPORT_H
+#define REPORT_EXPORT_H
+
+#include "date_utils.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <charconv>
+#include <cstring>
+#include <cstdint>
+using namespace std;
+
+// Append-only output through a fixed 1 MB buffer: rows are formatted in
+// place (to_chars, hand-rolled dates) and reach the stream in large writes,
+// so an export costs one pass over the data and no per-row strings.
+class ExportWriter {
+private:
+    static const size_t BUFFER_SIZE = 1 << 20;
+
+    ofstream out;
+    vector<char> buffer;
+    size_t used;
+    size_t flushed;
+    int cachedDay;      // last date written, and its text
+    char cachedDate[10];
+
+    char* reserve(size_t n) {
+        if (used + n > buffer.size()) flush();
+        if (n > buffer.size()) buffer.resize(n);
+        return buffer.data() + used;
+    }
+
+public:
+    ExportWriter() : buffer(BUFFER_SIZE), used(0), flushed(0), cachedDay(INT32_MIN) {}
+
+    ~ExportWriter() { close(); }
+
+    bool open(const string& path) {
+        out.open(path, ios::binary | ios::trunc);
+        return out.is_open();
+    }
+
+    bool good() const { return out.good(); }
+
+    void flush() {
+        if (used == 0) return;
+        out.write(buffer.data(), (streamsize)used);
+        flushed += used;
+        used = 0;
+    }
+
+    void close() {
+        if (!out.is_open()) return;
+        flush();
+        out.close();
+    }
+
+    size_t bytesWritten() const { return flushed + used; }
+
+    void put(char ch) {
+        *reserve(1) = ch;
+        used++;
+    }
+
+    void write(string_view text) {
+        memcpy(reserve(text.size()), text.data(), text.size());
+        used += text.size();
+    }
+
+    void writeInt(long long value) {
+        char* at = reserve(24);
+        used += (size_t)(to_chars(at, at + 24, value).ptr - at);
+    }
+
+    void writeDecimal(double value, int places) {
+        char* at = reserve(64);
+        used += (size_t)(to_chars(at, at + 64, value, chars_format::fixed, places).ptr - at);
+    }
+
+    // YYYY-MM-DD for a DateUtils day number; logs are grouped by day, so
+    // the previous date is usually the one asked for again.
+    void writeDate(int dayNumber) {
+        if (dayNumber != cachedDay) {
+            int y, m, d;
+            DateUtils::civilFromDays(dayNumber, y, m, d);
+            char* c = cachedDate;
+            c[0] = (char)('0' + y / 1000 % 10); c[1] = (char)('0' + y / 100 % 10);
+            c[2] = (char)('0' + y / 10 % 10);   c[3] = (char)('0' + y % 10);
+            c[4] = '-'; c[5] = (char)('0' + m / 10); c[6] = (char)('0' + m % 10);
+            c[7] = '-'; c[8] = (char)('0' + d / 10); c[9] = (char)('0' + d % 10);
+            cachedDay = dayNumber;
+        }
+        write(string_view(cachedDate, 10));
+    }
+};
+
+enum class ExportFormat { CSV, JSONL };
+
+// Optional row filters; the date range is inclusive and applies to the
+// report's own date column.
+struct ExportFilter {
+    bool hasFrom;
+    bool hasTo;
+    int fromDay;
+    int toDay;
+    string department; // empty = all departments
+
+    ExportFilter() : hasFrom(false), hasTo(false), fromDay(0), toDay(0) {}
+
+    bool hasDateRange() const { return hasFrom || hasTo; }
+
+    bool includesDay(int dayNumber) const {
+        return (!hasFrom || dayNumber >= fromDay) && (!hasTo || dayNumber <= toDay);
+    }
+
+    // Rows whose date is missing or not YYYY-MM-DD only pass without a range
+    bool includesDate(string_view date) const {
+        if (!hasDateRange()) return true;
+        int dayNumber;
+        return DateUtils::parseDate(date, dayNumber) && includesDay(dayNumber);
+    }
+};
+
+// Rows of a fixed column list, written as CSV (with a header line) or as
+// JSON Lines (one object per row, keyed by column name). Cells go in column
+// order between endRow() calls.
+class ExportTable {
+private:
+    ExportWriter& writer;
+    ExportFormat format;
+    vector<string> columns;
+    size_t column;
+    size_t rows;
+
+    void beginCell() {
+        if (format == ExportFormat::CSV) {
+            if (column > 0) writer.put(',');
+        } else {
+            writer.write(column == 0 ? "{\"" : ",\"");
+            writer.write(columns[column]);
+            writer.write("\":");
+        }
+        column++;
+    }
+
+    void writeCsvText(string_view text) {
+        if (text.find_first_of(",\"\r\n") == string_view::npos) {
+            writer.write(text);
+            return;
+        }
+        writer.put('"');
+        for (char ch : text) {
+            if (ch == '"') writer.put('"');
+            writer.put(ch);
+        }
+        writer.put('"');
+    }
+
+    void writeJsonText(string_view text) {
+        static const char* HEX = "0123456789abcdef";
+        writer.put('"');
+        size_t plain = 0;
+        for (size_t i = 0; i < text.size(); i++) {
+            unsigned char ch = (unsigned char)text[i];
+            if (ch >= 0x20 && ch != '"' && ch != '\\') continue;
+            writer.write(text.substr(plain, i - plain));
+            plain = i + 1;
+            if (ch == '"') writer.write("\\\"");
+            else if (ch == '\\') writer.write("\\\\");
+            else if (ch == '\n') writer.write("\\n");
+            else if (ch == '\r') writer.write("\\r");
+            else if (ch == '\t') writer.write("\\t");
+            else {
+                writer.write("\\u00");
+                writer.put(HEX[ch >> 4]);
+                writer.put(HEX[ch & 15]);
+            }
+        }
+        writer.write(text.substr(plain));
+        writer.put('"');
+    }
+
+public:
+    ExportTable(ExportWriter& w, ExportFormat f, vector<string> names)
+        : writer(w), format(f), columns(names), column(0), rows(0) {
+        if (format != ExportFormat::CSV) return;
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (i > 0) writer.put(',');
+            writer.write(columns[i]);
+        }
+        writer.put('\n');
+    }
+
+    size_t rowCount() const { return rows; }
+
+    void text(string_view value) {
+        beginCell();
+        if (format == ExportFormat::CSV) writeCsvText(value);
+        else writeJsonText(value);
+    }
+
+    void integer(long long value) {
+        beginCell();
+        writer.writeInt(value);
+    }
+
+    void decimal(double value, int places = 2) {
+        beginCell();
+        writer.writeDecimal(value, places);
+    }
+
+    void boolean(bool value) {
+        beginCell();
+        writer.write(format == ExportFormat::CSV ? (value ? "1" : "0") : (value ? "true" : "false"));
+    }
+
+    void date(int dayNumber) {
+        beginCell();
+        if (format == ExportFormat::JSONL) writer.put('"');
+        writer.writeDate(dayNumber);
+        if (format == ExportFormat::JSONL) writer.put('"');
+    }
+
+    void endRow() {
+        if (format == ExportFormat::JSONL) writer.put('}');
+        writer.put('\n');
+        column = 0;
+        rows++;
+    }
+};
+
+#endif
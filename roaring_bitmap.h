@@ -0,0 +1,243 @@
+#ifndef ROARING_BITMAP_H
+#define ROARING_BITMAP_H
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <charconv>
+#include <algorithm>
+using namespace std;
+
+// Compressed set of 32-bit IDs in the roaring layout: values are grouped by
+// their high 16 bits, and each group is stored either as a sorted array of
+// low halves (while it has at most 4096 members) or as a 65536-bit bitmap.
+// A sparse group costs 2 bytes per member, a dense one a flat 8 KB, so a
+// set of a million sequential employee IDs is about 128 KB, while a handful
+// of IDs costs a few bytes. Intersections and differences work a group at a
+// time, word by word where both sides are bitmaps.
+class RoaringBitmap {
+private:
+    static const size_t ARRAY_LIMIT = 4096;
+    static const size_t BITMAP_WORDS = 1024; // 65536 bits
+
+    struct Container {
+        uint16_t key;
+        uint32_t cardinality;
+        vector<uint16_t> values; // sorted low halves, while sparse
+        vector<uint64_t> words;  // BITMAP_WORDS words, once dense
+
+        bool isBitmap() const { return !words.empty(); }
+
+        bool contains(uint16_t low) const {
+            if (isBitmap()) return (words[low >> 6] >> (low & 63)) & 1;
+            return binary_search(values.begin(), values.end(), low);
+        }
+
+        bool add(uint16_t low) {
+            if (isBitmap()) {
+                uint64_t bit = 1ULL << (low & 63);
+                if (words[low >> 6] & bit) return false;
+                words[low >> 6] |= bit;
+                cardinality++;
+                return true;
+            }
+            auto it = lower_bound(values.begin(), values.end(), low);
+            if (it != values.end() && *it == low) return false;
+            values.insert(it, low);
+            cardinality++;
+            if (cardinality > ARRAY_LIMIT) {
+                words.assign(BITMAP_WORDS, 0);
+                for (uint16_t v : values) words[v >> 6] |= 1ULL << (v & 63);
+                vector<uint16_t>().swap(values);
+            }
+            return true;
+        }
+
+        template <typename F>
+        void forEach(F f) const {
+            uint32_t high = (uint32_t)key << 16;
+            if (!isBitmap()) {
+                for (uint16_t v : values) f(high | v);
+                return;
+            }
+            for (size_t w = 0; w < BITMAP_WORDS; w++) {
+                uint64_t bits = words[w];
+                while (bits) {
+                    f(high | (uint32_t)(w * 64 + __builtin_ctzll(bits)));
+                    bits &= bits - 1;
+                }
+            }
+        }
+
+        size_t andCardinality(const Container& other) const {
+            if (isBitmap() && other.isBitmap()) {
+                size_t n = 0;
+                for (size_t w = 0; w < BITMAP_WORDS; w++) n += __builtin_popcountll(words[w] & other.words[w]);
+                return n;
+            }
+            const Container& small = isBitmap() ? other : *this;
+            const Container& large = isBitmap() ? *this : other;
+            size_t n = 0;
+            for (uint16_t v : small.values) {
+                if (large.contains(v)) n++;
+            }
+            return n;
+        }
+
+        // Calls f for members of this container missing from other
+        template <typename F>
+        void forEachNotIn(const Container& other, F f) const {
+            uint32_t high = (uint32_t)key << 16;
+            if (isBitmap() && other.isBitmap()) {
+                for (size_t w = 0; w < BITMAP_WORDS; w++) {
+                    uint64_t bits = words[w] & ~other.words[w];
+                    while (bits) {
+                        f(high | (uint32_t)(w * 64 + __builtin_ctzll(bits)));
+                        bits &= bits - 1;
+                    }
+                }
+                return;
+            }
+            forEach([&](uint32_t v) {
+                if (!other.contains((uint16_t)(v & 0xFFFF))) f(v);
+            });
+        }
+    };
+
+    vector<Container> containers; // sorted by key
+
+    const Container* findContainer(uint16_t key) const {
+        auto it = lower_bound(containers.begin(), containers.end(), key,
+                              [](const Container& c, uint16_t k) { return c.key < k; });
+        return (it == containers.end() || it->key != key) ? nullptr : &*it;
+    }
+
+public:
+    RoaringBitmap() {}
+
+    // Returns true if value was not already present.
+    bool add(uint32_t value) {
+        uint16_t key = (uint16_t)(value >> 16);
+        auto it = lower_bound(containers.begin(), containers.end(), key,
+                              [](const Container& c, uint16_t k) { return c.key < k; });
+        if (it == containers.end() || it->key != key) {
+            Container c;
+            c.key = key;
+            c.cardinality = 0;
+            it = containers.insert(it, c);
+        }
+        return it->add((uint16_t)(value & 0xFFFF));
+    }
+
+    bool contains(uint32_t value) const {
+        const Container* c = findContainer((uint16_t)(value >> 16));
+        return c && c->contains((uint16_t)(value & 0xFFFF));
+    }
+
+    void clear() { containers.clear(); }
+
+    bool empty() const { return containers.empty(); }
+
+    size_t cardinality() const {
+        size_t n = 0;
+        for (const auto& c : containers) n += c.cardinality;
+        return n;
+    }
+
+    size_t bytesUsed() const {
+        size_t bytes = sizeof(*this) + containers.capacity() * sizeof(Container);
+        for (const auto& c : containers) {
+            bytes += c.values.capacity() * sizeof(uint16_t) + c.words.capacity() * sizeof(uint64_t);
+        }
+        return bytes;
+    }
+
+    // Members in ascending order
+    template <typename F>
+    void forEach(F f) const {
+        for (const auto& c : containers) c.forEach(f);
+    }
+
+    // |this AND other|
+    size_t andCardinality(const RoaringBitmap& other) const {
+        size_t n = 0;
+        size_t i = 0, j = 0;
+        while (i < containers.size() && j < other.containers.size()) {
+            if (containers[i].key < other.containers[j].key) i++;
+            else if (containers[i].key > other.containers[j].key) j++;
+            else n += containers[i++].andCardinality(other.containers[j++]);
+        }
+        return n;
+    }
+
+    // Calls f(value) for members of this set missing from other, ascending;
+    // f returns false to stop early.
+    template <typename F>
+    void forEachNotIn(const RoaringBitmap& other, F f) const {
+        bool stopped = false;
+        auto visit = [&](uint32_t v) {
+            if (!stopped && !f(v)) stopped = true;
+        };
+        size_t j = 0;
+        for (const auto& c : containers) {
+            while (j < other.containers.size() && other.containers[j].key < c.key) j++;
+            if (j < other.containers.size() && other.containers[j].key == c.key) {
+                c.forEachNotIn(other.containers[j], visit);
+            } else {
+                c.forEach(visit);
+            }
+            if (stopped) return;
+        }
+    }
+
+    // Text form used in the data files: ascending runs, "1001-1500,1503"
+    string toRunString() const {
+        string out;
+        bool open = false;
+        uint32_t runStart = 0, runEnd = 0;
+        auto flush = [&]() {
+            if (!out.empty()) out += ',';
+            out += to_string(runStart);
+            if (runEnd != runStart) out += "-" + to_string(runEnd);
+        };
+        forEach([&](uint32_t v) {
+            if (open && v == runEnd + 1) {
+                runEnd = v;
+                return;
+            }
+            if (open) flush();
+            runStart = runEnd = v;
+            open = true;
+        });
+        if (open) flush();
+        return out;
+    }
+
+    // Adds every value named by a run string; false on malformed input.
+    bool addRuns(string_view text) {
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t comma = text.find(',', start);
+            if (comma == string_view::npos) comma = text.size();
+            string_view run = text.substr(start, comma - start);
+            size_t dash = run.find('-');
+            uint32_t from, to;
+            if (!parseValue(run.substr(0, dash), from)) return false;
+            to = from;
+            if (dash != string_view::npos && !parseValue(run.substr(dash + 1), to)) return false;
+            if (to < from) return false;
+            for (uint64_t v = from; v <= to; v++) add((uint32_t)v);
+            start = comma + 1;
+        }
+        return true;
+    }
+
+private:
+    static bool parseValue(string_view text, uint32_t& value) {
+        auto result = from_chars(text.data(), text.data() + text.size(), value);
+        return result.ec == errc() && result.ptr == text.data() + text.size() && !text.empty();
+    }
+};
+
+#endif
@@ -0,0 +1,243 @@
+#ifndef SMTP_CLIENT_H
+#define SMTP_CLIENT_H
+
+#include <string>
+#include <atomic>
+#include <ctime>
+#include <cstdlib>
+using namespace std;
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+// One SMTP conversation with a relay: connect and EHLO once, then any
+// number of MAIL/RCPT/DATA transactions, then QUIT. Keeping the connection
+// open across a batch saves a TCP and greeting round trip per message.
+//
+// Replies are returned as the three-digit SMTP code, or -1 when the
+// connection failed or timed out (the session is then unusable).
+class SmtpSession {
+private:
+    int fd;
+    int timeoutSeconds;
+    string inbox;     // received bytes not yet consumed as reply lines
+    string lastReply; // text of the most recent reply, for error reports
+    const atomic<bool>* cancelled; // set by another thread to abandon the session
+
+    void closeSocket() {
+        if (fd < 0) return;
+#ifndef _WIN32
+        ::close(fd);
+#endif
+        fd = -1;
+    }
+
+#ifndef _WIN32
+    // Polls in short slices so a cancel request is noticed promptly
+    bool waitFor(short events) {
+        const int SLICE_MS = 200;
+        for (int waited = 0; waited < timeoutSeconds * 1000; waited += SLICE_MS) {
+            if (cancelled && cancelled->load()) return false;
+            pollfd p;
+            p.fd = fd;
+            p.events = events;
+            p.revents = 0;
+            int ready = ::poll(&p, 1, SLICE_MS);
+            if (ready < 0 && errno != EINTR) return false;
+            if (ready > 0) return !(p.revents & (POLLERR | POLLNVAL));
+        }
+        return false;
+    }
+
+    bool sendAll(const string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            if (!waitFor(POLLOUT)) return false;
+            ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n < 0 && (errno == EAGAIN || errno == EINTR)) continue;
+            if (n <= 0) return false;
+            sent += (size_t)n;
+        }
+        return true;
+    }
+
+    bool readLine(string& line) {
+        while (true) {
+            size_t nl = inbox.find('\n');
+            if (nl != string::npos) {
+                line = inbox.substr(0, nl);
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                inbox.erase(0, nl + 1);
+                return true;
+            }
+            if (!waitFor(POLLIN)) return false;
+            char buf[4096];
+            ssize_t n = ::recv(fd, buf, sizeof(buf), 0);
+            if (n < 0 && (errno == EAGAIN || errno == EINTR)) continue;
+            if (n <= 0) return false;
+            inbox.append(buf, (size_t)n);
+        }
+    }
+#endif
+
+    // Reads one (possibly multi-line "250-...") reply
+    int readReply() {
+#ifndef _WIN32
+        string line;
+        lastReply.clear();
+        while (readLine(line)) {
+            if (line.size() < 3) break;
+            if (!lastReply.empty()) lastReply += " ";
+            lastReply += line;
+            if (line.size() == 3 || line[3] != '-') return atoi(line.substr(0, 3).c_str());
+        }
+#endif
+        if (lastReply.empty()) lastReply = "connection lost";
+        closeSocket();
+        return -1;
+    }
+
+    bool fail() {
+        closeSocket();
+        return false;
+    }
+
+    int command(const string& line) {
+        if (fd < 0) return -1;
+#ifndef _WIN32
+        if (!sendAll(line + "\r\n")) {
+            lastReply = "connection lost";
+            closeSocket();
+            return -1;
+        }
+#endif
+        return readReply();
+    }
+
+    // Message body with CRLF line endings and leading dots doubled
+    static string dotStuff(const string& text) {
+        string out;
+        out.reserve(text.size() + 64);
+        bool lineStart = true;
+        for (size_t i = 0; i < text.size(); i++) {
+            char ch = text[i];
+            if (ch == '\r') continue;
+            if (lineStart && ch == '.') out += '.';
+            if (ch == '\n') {
+                out += "\r\n";
+                lineStart = true;
+            } else {
+                out += ch;
+                lineStart = false;
+            }
+        }
+        if (!lineStart) out += "\r\n";
+        return out;
+    }
+
+    static string rfc2822Date() {
+        time_t now = time(0);
+        char buffer[64];
+        strftime(buffer, sizeof(buffer), "%a, %d %b %Y %H:%M:%S %z", localtime(&now));
+        return buffer;
+    }
+
+public:
+    SmtpSession(int timeout, const atomic<bool>* cancelFlag = nullptr)
+        : fd(-1), timeoutSeconds(timeout), cancelled(cancelFlag) {}
+
+    ~SmtpSession() { closeSocket(); }
+
+    bool isOpen() const { return fd >= 0; }
+    string getLastReply() const { return lastReply; }
+
+    // Connects and completes the greeting and EHLO (HELO as fallback)
+    bool open(const string& host, int port, const string& heloName) {
+#ifdef _WIN32
+        (void)host; (void)port; (void)heloName;
+        lastReply = "SMTP delivery is not available in Windows builds";
+        return false;
+#else
+        addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* addrs = nullptr;
+        if (getaddrinfo(host.c_str(), to_string(port).c_str(), &hints, &addrs) != 0 || !addrs) {
+            lastReply = "cannot resolve " + host;
+            return false;
+        }
+        for (addrinfo* a = addrs; a && fd < 0; a = a->ai_next) {
+            fd = ::socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+            if (fd < 0) continue;
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+            int rc = ::connect(fd, a->ai_addr, a->ai_addrlen);
+            int err = 0;
+            socklen_t len = sizeof(err);
+            if (rc == 0 || (errno == EINPROGRESS && waitFor(POLLOUT) &&
+                            getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0)) {
+                break;
+            }
+            ::close(fd);
+            fd = -1;
+        }
+        freeaddrinfo(addrs);
+        if (fd < 0) {
+            lastReply = "cannot connect to " + host + ":" + to_string(port);
+            return false;
+        }
+
+        if (readReply() != 220) return fail();
+        int code = command("EHLO " + heloName);
+        if (code != 250 && code != -1) code = command("HELO " + heloName);
+        if (code != 250) return fail();
+        return true;
+#endif
+    }
+
+    // One transaction. Returns 250 on success, otherwise the failing code.
+    // After a refused message the session is reset and can carry the next.
+    int send(const string& from, const string& to, const string& subject,
+             const string& body, const string& messageId) {
+        int code = command("MAIL FROM:<" + from + ">");
+        if (code == 250) {
+            code = command("RCPT TO:<" + to + ">");
+            if (code == 251) code = 250;
+        }
+        if (code == 250) {
+            code = command("DATA");
+            if (code == 354) {
+                string data = "From: <" + from + ">\r\n"
+                              "To: <" + to + ">\r\n"
+                              "Subject: " + subject + "\r\n"
+                              "Date: " + rfc2822Date() + "\r\n"
+                              "Message-ID: <" + messageId + ">\r\n"
+                              "\r\n" + dotStuff(body) + ".";
+                code = command(data);
+            } else if (code == 250) {
+                code = 554; // DATA must answer 354
+            }
+        }
+        if (code != 250 && code != -1) {
+            string refusal = lastReply;
+            command("RSET");
+            lastReply = refusal;
+        }
+        return code;
+    }
+
+    void quit() {
+        if (fd >= 0) command("QUIT");
+        closeSocket();
+    }
+};
+
+#endif
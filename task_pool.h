@@ -0,0 +1,53 @@
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+using namespace std;
+
+// Small fixed-size pool: runs a batch of independent tasks on at most
+// maxThreads worker threads and returns once all of them have finished.
+class TaskPool {
+private:
+    size_t maxThreads;
+
+public:
+    TaskPool() : maxThreads(defaultThreadCount()) {}
+    explicit TaskPool(size_t threads) : maxThreads(threads == 0 ? 1 : threads) {}
+
+    static size_t defaultThreadCount() {
+        unsigned int hw = thread::hardware_concurrency();
+        return hw == 0 ? 4 : hw;
+    }
+
+    size_t getMaxThreads() const { return maxThreads; }
+
+    void run(const vector<function<void()>>& tasks) const {
+        if (tasks.empty()) return;
+        size_t workerCount = min(maxThreads, tasks.size());
+        if (workerCount == 1) {
+            for (const auto& task : tasks) task();
+            return;
+        }
+
+        atomic<size_t> next(0);
+        auto worker = [&tasks, &next]() {
+            size_t i;
+            while ((i = next.fetch_add(1)) < tasks.size()) {
+                tasks[i]();
+            }
+        };
+
+        vector<thread> workers;
+        for (size_t i = 1; i < workerCount; i++) {
+            workers.emplace_back(worker);
+        }
+        worker(); // calling thread takes part too
+        for (auto& t : workers) t.join();
+    }
+};
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef TEXT_INDEX_H
+#define TEXT_INDEX_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <cctype>
+using namespace std;
+
+// Tokenized inverted index over free text, keyed by an integer document ID.
+//
+// Query syntax: whitespace-separated terms are ANDed ("AND" is accepted but
+// optional), "OR" separates alternatives, and a trailing '*' makes a term a
+// prefix match ("proj*"). Results are ranked by a TF-IDF score.
+class TextIndex {
+private:
+    struct Posting {
+        int docId;
+        int termFreq;
+    };
+
+    // Sorted by term so a prefix query is a single range scan; each postings
+    // list is kept sorted by docId so AND/OR are linear merges.
+    map<string, vector<Posting>> postings;
+    unordered_map<int, vector<string>> docTerms; // forward index, for updates
+
+    typedef vector<pair<int, double>> ScoredDocs; // sorted by docId
+
+    double idf(size_t docFreq) const {
+        return log(1.0 + (double)docTerms.size() / (double)docFreq);
+    }
+
+    void addPostings(const vector<Posting>& list, ScoredDocs& out) const {
+        double weight = idf(list.size());
+        out.reserve(out.size() + list.size());
+        for (const auto& p : list) {
+            out.push_back({p.docId, p.termFreq * weight});
+        }
+    }
+
+    static ScoredDocs mergeUnion(const ScoredDocs& a, const ScoredDocs& b) {
+        ScoredDocs out;
+        out.reserve(a.size() + b.size());
+        size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i].first < b[j].first) out.push_back(a[i++]);
+            else if (b[j].first < a[i].first) out.push_back(b[j++]);
+            else {
+                out.push_back({a[i].first, a[i].second + b[j].second});
+                i++; j++;
+            }
+        }
+        while (i < a.size()) out.push_back(a[i++]);
+        while (j < b.size()) out.push_back(b[j++]);
+        return out;
+    }
+
+    static ScoredDocs mergeIntersect(const ScoredDocs& a, const ScoredDocs& b) {
+        ScoredDocs out;
+        size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i].first < b[j].first) i++;
+            else if (b[j].first < a[i].first) j++;
+            else {
+                out.push_back({a[i].first, a[i].second + b[j].second});
+                i++; j++;
+            }
+        }
+        return out;
+    }
+
+    ScoredDocs matchTerm(const string& term) const {
+        ScoredDocs result;
+        if (term.size() > 1 && term.back() == '*') {
+            string prefix = term.substr(0, term.size() - 1);
+            ScoredDocs all;
+            for (auto it = postings.lower_bound(prefix);
+                 it != postings.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+                addPostings(it->second, all);
+            }
+            sort(all.begin(), all.end());
+            for (const auto& hit : all) {
+                if (!result.empty() && result.back().first == hit.first) result.back().second += hit.second;
+                else result.push_back(hit);
+            }
+        } else {
+            auto it = postings.find(term);
+            if (it != postings.end()) addPostings(it->second, result);
+        }
+        return result;
+    }
+
+public:
+    TextIndex() {}
+
+    // Lower-cased alphanumeric runs; everything else separates tokens.
+    static vector<string> tokenize(const string& text) {
+        vector<string> tokens;
+        string current;
+        for (char ch : text) {
+            unsigned char c = (unsigned char)ch;
+            if (isalnum(c)) {
+                current += (char)tolower(c);
+            } else if (!current.empty()) {
+                tokens.push_back(current);
+                current.clear();
+            }
+        }
+        if (!current.empty()) tokens.push_back(current);
+        return tokens;
+    }
+
+    void addDocument(int docId, const string& text) {
+        if (docTerms.count(docId)) removeDocument(docId);
+
+        map<string, int> freq;
+        for (const auto& token : tokenize(text)) freq[token]++;
+
+        vector<string>& terms = docTerms[docId];
+        for (const auto& entry : freq) {
+            vector<Posting>& list = postings[entry.first];
+            Posting p = {docId, entry.second};
+            if (list.empty() || list.back().docId < docId) {
+                list.push_back(p); // common case: IDs arrive in increasing order
+            } else {
+                auto pos = lower_bound(list.begin(), list.end(), docId,
+                                       [](const Posting& a, int id) { return a.docId < id; });
+                list.insert(pos, p);
+            }
+            terms.push_back(entry.first);
+        }
+    }
+
+    void removeDocument(int docId) {
+        auto doc = docTerms.find(docId);
+        if (doc == docTerms.end()) return;
+        for (const auto& term : doc->second) {
+            auto it = postings.find(term);
+            if (it == postings.end()) continue;
+            vector<Posting>& list = it->second;
+            auto pos = lower_bound(list.begin(), list.end(), docId,
+                                   [](const Posting& a, int id) { return a.docId < id; });
+            if (pos != list.end() && pos->docId == docId) list.erase(pos);
+            if (list.empty()) postings.erase(it);
+        }
+        docTerms.erase(doc);
+    }
+
+    void clear() {
+        postings.clear();
+        docTerms.clear();
+    }
+
+    size_t getDocumentCount() const { return docTerms.size(); }
+    size_t getTermCount() const { return postings.size(); }
+
+    // Returns up to `limit` (docId, score) pairs, best first.
+    vector<pair<int, double>> search(const string& query, size_t limit = 20) const {
+        vector<vector<string>> groups(1);
+        string word;
+        vector<string> words;
+        for (char ch : query) {
+            if (isspace((unsigned char)ch)) {
+                if (!word.empty()) words.push_back(word);
+                word.clear();
+            } else {
+                word += ch;
+            }
+        }
+        if (!word.empty()) words.push_back(word);
+
+        for (const auto& w : words) {
+            if (w == "OR" || w == "or") {
+                if (!groups.back().empty()) groups.push_back(vector<string>());
+                continue;
+            }
+            if (w == "AND" || w == "and") continue;
+            bool prefix = w.back() == '*';
+            vector<string> parts = tokenize(w);
+            for (size_t i = 0; i < parts.size(); i++) {
+                // Only the last fragment of "foo-ba*" keeps the prefix marker
+                groups.back().push_back(prefix && i + 1 == parts.size() ? parts[i] + "*" : parts[i]);
+            }
+        }
+
+        ScoredDocs combined;
+        for (const auto& group : groups) {
+            if (group.empty()) continue;
+            vector<ScoredDocs> matches;
+            for (const auto& term : group) matches.push_back(matchTerm(term));
+            // Intersect smallest lists first to keep intermediate results short
+            sort(matches.begin(), matches.end(),
+                 [](const ScoredDocs& a, const ScoredDocs& b) { return a.size() < b.size(); });
+            ScoredDocs groupResult = matches[0];
+            for (size_t i = 1; i < matches.size() && !groupResult.empty(); i++) {
+                groupResult = mergeIntersect(groupResult, matches[i]);
+            }
+            combined = mergeUnion(combined, groupResult);
+        }
+
+        size_t keep = min(limit, combined.size());
+        partial_sort(combined.begin(), combined.begin() + keep, combined.end(),
+                     [](const pair<int, double>& a, const pair<int, double>& b) {
+                         return a.second != b.second ? a.second > b.second : a.first < b.first;
+                     });
+        combined.resize(keep);
+        return combined;
+    }
+};
+
+#endif